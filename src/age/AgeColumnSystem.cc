@@ -17,6 +17,8 @@
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <cmath>                // fabs
+
 #include "AgeColumnSystem.hh"
 
 #include "pism/util/error_handling.hh"
@@ -40,7 +42,10 @@ AgeColumnSystem::AgeColumnSystem(const std::vector<double>& storage_grid,
   m_A_s.resize(Mz);
   m_A_w.resize(Mz);
 
-  m_nu = m_dt / m_dz; // derived constant
+  // derived constants
+  m_nu         = m_dt / m_dz;
+  m_dt_over_dx = m_dt / m_dx;
+  m_dt_over_dy = m_dt / m_dy;
 }
 
 void AgeColumnSystem::init(int i, int j, double thickness) {
@@ -54,11 +59,33 @@ void AgeColumnSystem::init(int i, int j, double thickness) {
   coarse_to_fine(m_v3, i, j, &m_v[0]);
   coarse_to_fine(m_w3, i, j, &m_w[0]);
 
-  coarse_to_fine(m_age3, m_i, m_j,   &m_A[0]);
-  coarse_to_fine(m_age3, m_i, m_j+1, &m_A_n[0]);
-  coarse_to_fine(m_age3, m_i+1, m_j, &m_A_e[0]);
-  coarse_to_fine(m_age3, m_i, m_j-1, &m_A_s[0]);
-  coarse_to_fine(m_age3, m_i-1, m_j, &m_A_w[0]);
+  coarse_to_fine(m_age3, m_i, m_j, &m_A[0]);
+
+  // The upwind right-hand side in solve() multiplies the east neighbor by
+  // u[k] only where u[k] < 0, the west one only where u[k] > 0, and
+  // similarly in the y-direction: interpolate only the neighbor columns this
+  // column's flow can see. Where the flow direction does not change with
+  // depth (most of the domain) this skips two of the four neighbor columns.
+  bool east = false, west = false, north = false, south = false;
+  for (unsigned int k = 0; k < m_ks; ++k) {
+    east  = east  or m_u[k] < 0.0;
+    west  = west  or m_u[k] > 0.0;
+    north = north or m_v[k] < 0.0;
+    south = south or m_v[k] > 0.0;
+  }
+
+  if (north) {
+    coarse_to_fine(m_age3, m_i, m_j+1, &m_A_n[0]);
+  }
+  if (east) {
+    coarse_to_fine(m_age3, m_i+1, m_j, &m_A_e[0]);
+  }
+  if (south) {
+    coarse_to_fine(m_age3, m_i, m_j-1, &m_A_s[0]);
+  }
+  if (west) {
+    coarse_to_fine(m_age3, m_i-1, m_j, &m_A_w[0]);
+  }
 }
 
 //! First-order upwind scheme with implicit in the vertical: one column solve.
@@ -73,28 +100,28 @@ void AgeColumnSystem::solve(std::vector<double> &x) {
   // set up system: 0 <= k < m_ks
   for (unsigned int k = 0; k < m_ks; k++) {
     // do lowest-order upwinding, explicitly for horizontal
-    S.RHS(k) =  (m_u[k] < 0 ?
-                 m_u[k] * (m_A_e[k] -  m_A[k]) / m_dx :
-                 m_u[k] * (m_A[k]  - m_A_w[k]) / m_dx);
-    S.RHS(k) += (m_v[k] < 0 ?
-                 m_v[k] * (m_A_n[k] -  m_A[k]) / m_dy :
-                 m_v[k] * (m_A[k]  - m_A_s[k]) / m_dy);
+    const double
+      U_x = (m_u[k] < 0 ?
+             m_u[k] * (m_A_e[k] -  m_A[k]) :
+             m_u[k] * (m_A[k]  - m_A_w[k])),
+      U_y = (m_v[k] < 0 ?
+             m_v[k] * (m_A_n[k] -  m_A[k]) :
+             m_v[k] * (m_A[k]  - m_A_s[k]));
     // note it is the age eqn: dage/dt = 1.0 and we have moved the hor.
-    //   advection terms over to right:
-    S.RHS(k) = m_A[k] + m_dt * (1.0 - S.RHS(k));
+    //   advection terms over to right; dt/dx and dt/dy are pre-computed so
+    //   this loop is division-free
+    S.RHS(k) = m_A[k] + m_dt - (U_x * m_dt_over_dx + U_y * m_dt_over_dy);
 
     // do lowest-order upwinding, *implicitly* for vertical
     double AA = m_nu * m_w[k];
     if (k > 0) {
-      if (AA >= 0) { // upward velocity
-        S.L(k) = - AA;
-        S.D(k) = 1.0 + AA;
-        S.U(k) = 0.0;
-      } else { // downward velocity; note  -AA >= 0
-        S.L(k) = 0.0;
-        S.D(k) = 1.0 - AA;
-        S.U(k) = + AA;
-      }
+      // branchless form of the upward/downward cases: for AA >= 0 this gives
+      // L = -AA, D = 1 + AA, U = 0 and for AA < 0 it gives L = 0,
+      // D = 1 - AA, U = AA, exactly (halving and doubling are exact)
+      const double AA_abs = fabs(AA);
+      S.L(k) = -0.5 * (AA + AA_abs);
+      S.D(k) = 1.0 + AA_abs;
+      S.U(k) = 0.5 * (AA - AA_abs);
     } else { // k == 0 case
       // note L[0] is not used
       if (AA > 0) { // if strictly upward velocity apply boundary condition:
@@ -40,7 +40,7 @@ public:
   void solve(std::vector<double> &x);
 protected:
   const IceModelVec3 &m_age3;
-  double m_nu;
+  double m_nu, m_dt_over_dx, m_dt_over_dy;
   std::vector<double> m_A, m_A_n, m_A_e, m_A_s, m_A_w;
 };
 
@@ -17,6 +17,8 @@
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <algorithm>            // std::min
+
 #include "AgeModel.hh"
 
 #include "pism/age/AgeColumnSystem.hh"
@@ -127,35 +129,52 @@ void AgeModel::update(double t, double dt, const AgeModelInputs &inputs) {
 
   IceModelVec::AccessList list{&ice_thickness, &u3, &v3, &w3, &m_ice_age, &m_work};
 
-  unsigned int Mz = m_grid->Mz();
+  const int
+    xs = m_grid->xs(), xm = m_grid->xm(),
+    ys = m_grid->ys(), ym = m_grid->ym();
+
+  // Process the subdomain in strips of columns: the age column at (i, j) is
+  // re-read as a neighbor while the four surrounding columns are processed,
+  // and a strip a few rows of columns deep stays cache-resident while that
+  // happens. (Columns are independent, so the traversal order does not
+  // affect results.)
+  const int strip_width = 32;
 
   ParallelSection loop(m_grid->com);
   try {
-    for (Points p(*m_grid); p; p.next()) {
-      const int i = p.i(), j = p.j();
-
-      system.init(i, j, ice_thickness(i, j));
-
-      if (system.ks() == 0) {
-        // if no ice, set the entire column to zero age
-        m_work.set_column(i, j, 0.0);
-      } else {
-        // general case: solve advection PDE
-
-        // solve the system for this column; call checks that params set
-        system.solve(x);
-
-        // put solution in IceModelVec3
-        system.fine_to_coarse(x, i, j, m_work);
-
-        // Ensure that the age of the ice is non-negative.
-        //
-        // FIXME: this is a kludge. We need to ensure that our numerical method has the maximum
-        // principle instead. (We may still need this for correctness, though.)
-        double *column = m_work.get_column(i, j);
-        for (unsigned int k = 0; k < Mz; ++k) {
-          if (column[k] < 0.0) {
-            column[k] = 0.0;
+    for (int i0 = xs; i0 < xs + xm; i0 += strip_width) {
+      const int i_end = std::min(i0 + strip_width, xs + xm);
+
+      for (int j = ys; j < ys + ym; j++) {
+        for (int i = i0; i < i_end; i++) {
+
+          const double H = ice_thickness(i, j);
+
+          // Ice-free cells are the common case on continental grids: zero the
+          // column without paying for the system setup (which clears the
+          // tridiagonal coefficient arrays even if the solve never runs).
+          if (H <= 0.0) {
+            m_work.set_column(i, j, 0.0);
+            continue;
+          }
+
+          system.init(i, j, H);
+
+          if (system.ks() == 0) {
+            // if no ice, set the entire column to zero age
+            m_work.set_column(i, j, 0.0);
+          } else {
+            // general case: solve advection PDE
+
+            // solve the system for this column; call checks that params set
+            system.solve(x);
+
+            // Put the solution in the IceModelVec3, ensuring that the age of
+            // the ice is non-negative as it is written back.
+            //
+            // FIXME: the clamping is a kludge. We need to ensure that our numerical method has
+            // the maximum principle instead. (We may still need this for correctness, though.)
+            system.fine_to_coarse_clamped(x, i, j, m_work, 0.0);
           }
         }
       }
@@ -65,12 +65,36 @@ MohrCoulombYieldStress::MohrCoulombYieldStress(IceGrid::ConstPtr g)
                        "degrees", "");
   m_till_phi.set_time_independent(true);
   // in this model; need not be time-independent in general
+
+  m_tan_phi.create(m_grid, "tan_tillphi", WITHOUT_GHOSTS);
+  m_tan_phi.set_attrs("internal",
+                      "tangent of the till friction angle (cached)",
+                      "", "");
 }
 
 MohrCoulombYieldStress::~MohrCoulombYieldStress() {
   // empty
 }
 
+//! Effective pressure on till, using the empirical relation [@ref Tulaczyketal2000]
+//! shared by update_impl() and the tauc-to-tillphi inversion.
+/*!
+  @param[in] s ratio of the till water amount to its maximum
+  @param[in] P_overburden overburden pressure
+  @param[in] N0 reference effective pressure
+  @param[in] ln10_e0overCc precomputed M_LN10 * (e_0 / C_c)
+  @param[in] delta fraction of the overburden pressure
+*/
+static inline double effective_pressure_on_till(double s, double P_overburden,
+                                                double N0, double ln10_e0overCc,
+                                                double delta) {
+  // single-transcendental form of N0 * (delta*Po/N0)^s * 10^(e0overCc*(1-s)):
+  // one log and one exp instead of pow() plus exp()
+  double Ntill = N0 * exp(s * log(delta * P_overburden / N0) + ln10_e0overCc * (1.0 - s));
+  // fmin() compiles to a branch-free FP min instruction, unlike std::min()
+  return std::fmin(P_overburden, Ntill);
+}
+
 
 //! Initialize the pseudo-plastic till mechanical model.
 /*!
@@ -184,6 +208,34 @@ void MohrCoulombYieldStress::init_impl(const Geometry &geometry,
     m_basal_yield_stress.set(0.0);
     // will be set in update_impl()
   }
+
+  compute_tan_phi();
+}
+
+//! Re-compute the cached tan((pi/180) * tillphi).
+/*!
+  tillphi is time-independent in this model, so its tangent needs to be
+  computed only when tillphi itself changes (at initialization or when it is
+  reset by inverse modeling). This saves one tan() per grounded icy cell per
+  time step in update_impl().
+*/
+void MohrCoulombYieldStress::compute_tan_phi() {
+  const double deg_to_rad = M_PI / 180.0;
+
+  IceModelVec::AccessList list{&m_till_phi, &m_tan_phi};
+
+  const int
+    xs = m_grid->xs(), xm = m_grid->xm(),
+    ys = m_grid->ys(), ym = m_grid->ym();
+
+  for (int j = ys; j < ys + ym; j++) {
+    const double *phi_row = m_till_phi.row(j);
+    double *tan_phi_row   = m_tan_phi.row(j);
+
+    for (int i = xs; i < xs + xm; i++) {
+      tan_phi_row[i] = tan(deg_to_rad * phi_row[i]);
+    }
+  }
 }
 
 MaxTimestep MohrCoulombYieldStress::max_timestep_impl(double t) const {
@@ -193,6 +245,8 @@ MaxTimestep MohrCoulombYieldStress::max_timestep_impl(double t) const {
 
 void MohrCoulombYieldStress::set_till_friction_angle(const IceModelVec2S &input) {
   m_till_phi.copy_from(input);
+
+  compute_tan_phi();
 }
 
 
@@ -204,6 +258,78 @@ void MohrCoulombYieldStress::write_model_state_impl(const PIO &output) const {
   m_till_phi.write(output);
 }
 
+//! Parameters of the tauc update, hoisted out of the per-cell kernel.
+struct MohrCoulombParams {
+  double high_tauc, W_till_max, c0, N0, delta, tlftw,
+    rho_g, inv_W_till_max, ln10_e0overCc, inv_tlftw;
+};
+
+//! One sweep of the Mohr-Coulomb tauc update.
+/*!
+  The two configuration flags are template parameters so that each of the four
+  instantiations contains only the branches it actually needs: with the
+  default settings the per-cell water selection collapses to a single load.
+*/
+template <bool slippery_grounding_lines, bool add_transportable_water>
+static void mohr_coulomb_sweep(const IceGrid &grid, const MohrCoulombParams &p,
+                               const IceModelVec2CellType &cell_type,
+                               const IceModelVec2S &W_till,
+                               const IceModelVec2S &W_subglacial,
+                               const IceModelVec2S &bed_topography,
+                               const IceModelVec2S &sea_level,
+                               const IceModelVec2S &ice_thickness,
+                               const IceModelVec2S &tan_phi,
+                               IceModelVec2S &basal_yield_stress) {
+
+  const int
+    xs = grid.xs(), xm = grid.xm(),
+    ys = grid.ys(), ym = grid.ym();
+
+  // This is a per-cell kernel evaluated over the whole grid every time step, so we
+  // traverse rows in storage order using row pointers instead of operator() to keep
+  // accesses unit-stride and cheap to index.
+  for (int j = ys; j < ys + ym; j++) {
+    const double
+      *W_till_row  = W_till.row(j),
+      *bed_row     = bed_topography.row(j),
+      *sl_row      = sea_level.row(j),
+      *H_row       = ice_thickness.row(j),
+      *tan_phi_row = tan_phi.row(j),
+      *mask_row    = cell_type.row(j);
+    double *tauc_row = basal_yield_stress.row(j);
+
+    for (int i = xs; i < xs + xm; i++) {
+      // classify the cell once instead of re-reading the mask in every predicate
+      const int M = static_cast<int>(floor(mask_row[i] + 0.5));
+
+      if (mask::ocean(M)) {
+        tauc_row[i] = 0.0;
+      } else if (mask::ice_free(M)) {
+        tauc_row[i] = p.high_tauc;  // large yield stress if grounded and ice-free
+      } else { // grounded and there is some ice
+        // user can ask that marine grounding lines get special treatment
+        double water = W_till_row[i]; // usual case
+        if (slippery_grounding_lines and
+            bed_row[i] <= sl_row[i] and
+            (cell_type.next_to_floating_ice(i,j) or cell_type.next_to_ice_free_ocean(i,j))) {
+          water = p.W_till_max;
+        } else if (add_transportable_water) {
+          // log1p() is both faster and more accurate than log(1 + x) for the
+          // small arguments typical here
+          water = W_till_row[i] + p.tlftw * log1p(W_subglacial(i,j) * p.inv_tlftw);
+        }
+        const double
+          s            = water * p.inv_W_till_max,
+          P_overburden = p.rho_g * H_row[i],
+          Ntill        = effective_pressure_on_till(s, P_overburden,
+                                                    p.N0, p.ln10_e0overCc, p.delta);
+
+        tauc_row[i] = p.c0 + Ntill * tan_phi_row[i];
+      }
+    }
+  }
+}
+
 //! Update the till yield stress for use in the pseudo-plastic till basal stress
 //! model.  See also IceBasalResistancePlasticLaw.
 /*!
@@ -260,37 +386,45 @@ void MohrCoulombYieldStress::update_impl(const YieldStressInputs &inputs) {
   const IceModelVec2S        &bed_topography = inputs.geometry->bed_elevation;
   const IceModelVec2S        &sea_level      = inputs.geometry->sea_level_elevation;
 
-  IceModelVec::AccessList list{&W_till, &m_till_phi, &m_basal_yield_stress, &cell_type,
+  IceModelVec::AccessList list{&W_till, &m_tan_phi, &m_basal_yield_stress, &cell_type,
       &bed_topography, &sea_level, &ice_thickness};
   if (add_transportable_water) {
     list.add(W_subglacial);
   }
 
-  for (Points p(*m_grid); p; p.next()) {
-    const int i = p.i(), j = p.j();
-
-    if (cell_type.ocean(i, j)) {
-      m_basal_yield_stress(i, j) = 0.0;
-    } else if (cell_type.ice_free(i, j)) {
-      m_basal_yield_stress(i, j) = high_tauc;  // large yield stress if grounded and ice-free
-    } else { // grounded and there is some ice
-      // user can ask that marine grounding lines get special treatment
-      double water = W_till(i,j); // usual case
-      if (slippery_grounding_lines and
-          bed_topography(i,j) <= sea_level(i, j) and
-          (cell_type.next_to_floating_ice(i,j) or cell_type.next_to_ice_free_ocean(i,j))) {
-        water = W_till_max;
-      } else if (add_transportable_water) {
-        water = W_till(i,j) + tlftw * log(1.0 + W_subglacial(i,j) / tlftw);
-      }
-      double
-        s    = water / W_till_max,
-        P_overburden = ice_density * standard_gravity * ice_thickness(i, j),
-        Ntill = N0 * pow(delta * P_overburden / N0, s) * pow(10.0, e0overCc * (1.0 - s));
-      Ntill = std::min(P_overburden, Ntill);
-
-      m_basal_yield_stress(i, j) = c0 + Ntill * tan((M_PI/180.0) * m_till_phi(i, j));
+  MohrCoulombParams params;
+  params.high_tauc      = high_tauc;
+  params.W_till_max     = W_till_max;
+  params.c0             = c0;
+  params.N0             = N0;
+  params.delta          = delta;
+  params.tlftw          = tlftw;
+  // hoisted loop invariants
+  params.rho_g          = ice_density * standard_gravity;
+  params.inv_W_till_max = 1.0 / W_till_max;
+  params.ln10_e0overCc  = M_LN10 * e0overCc;
+  params.inv_tlftw      = 1.0 / tlftw;
+
+  // Dispatch to the sweep specialized on the two configuration flags (see
+  // mohr_coulomb_sweep()).
+  if (slippery_grounding_lines) {
+    if (add_transportable_water) {
+      mohr_coulomb_sweep<true, true>(*m_grid, params, cell_type, W_till, W_subglacial,
+                                     bed_topography, sea_level, ice_thickness,
+                                     m_tan_phi, m_basal_yield_stress);
+    } else {
+      mohr_coulomb_sweep<true, false>(*m_grid, params, cell_type, W_till, W_subglacial,
+                                      bed_topography, sea_level, ice_thickness,
+                                      m_tan_phi, m_basal_yield_stress);
     }
+  } else if (add_transportable_water) {
+    mohr_coulomb_sweep<false, true>(*m_grid, params, cell_type, W_till, W_subglacial,
+                                    bed_topography, sea_level, ice_thickness,
+                                    m_tan_phi, m_basal_yield_stress);
+  } else {
+    mohr_coulomb_sweep<false, false>(*m_grid, params, cell_type, W_till, W_subglacial,
+                                     bed_topography, sea_level, ice_thickness,
+                                     m_tan_phi, m_basal_yield_stress);
   }
 
   m_basal_yield_stress.update_ghosts();
@@ -346,15 +480,12 @@ void MohrCoulombYieldStress::till_friction_angle(const IceModelVec2S &bed_topogr
 
   for (Points p(*m_grid); p; p.next()) {
     const int i = p.i(), j = p.j();
-    const double bed = bed_topography(i, j);
 
-    if (bed <= topg_min) {
-      result(i, j) = phi_min;
-    } else if (bed >= topg_max) {
-      result(i, j) = phi_max;
-    } else {
-      result(i, j) = phi_min + (bed - topg_min) * slope;
-    }
+    // branch-free form of the piecewise-linear function: clamp the bed
+    // elevation to [topg_min, topg_max], then apply the linear ramp
+    const double bed = std::fmax(topg_min, std::fmin(bed_topography(i, j), topg_max));
+
+    result(i, j) = phi_min + (bed - topg_min) * slope;
   }
 
   // communicate ghosts so that the tauc computation can be performed locally
@@ -385,6 +516,10 @@ void MohrCoulombYieldStress::till_friction_angle(const IceModelVec2S &basal_yiel
     &W_till = till_water_thickness,
     &Po     = overburden_pressure;
 
+  const double
+    inv_W_till_max = 1.0 / W_till_max,
+    ln10_e0overCc  = M_LN10 * e0overCc;
+
   IceModelVec::AccessList list{&cell_type, &basal_yield_stress, &W_till, &Po, &result};
 
   for (Points p(*m_grid); p; p.next()) {
@@ -395,10 +530,9 @@ void MohrCoulombYieldStress::till_friction_angle(const IceModelVec2S &basal_yiel
     } else if (cell_type.ice_free(i, j)) {
       // no change
     } else { // grounded and there is some ice
-      const double s = W_till(i, j) / W_till_max;
-
-      double Ntill = N0 * pow(delta * Po(i, j) / N0, s) * pow(10.0, e0overCc * (1.0 - s));
-      Ntill = std::min(Po(i, j), Ntill);
+      const double
+        s     = W_till(i, j) * inv_W_till_max,
+        Ntill = effective_pressure_on_till(s, Po(i, j), N0, ln10_e0overCc, delta);
 
       result(i, j) = 180.0/M_PI * atan((basal_yield_stress(i, j) - c0) / Ntill);
     }
@@ -58,7 +58,11 @@ private:
                            const IceModelVec2CellType &cell_type,
                            IceModelVec2S &result);
 
+  void compute_tan_phi();
+
   IceModelVec2S m_till_phi;
+  //! tan((pi/180) * tillphi), cached because tillphi does not evolve during a run
+  IceModelVec2S m_tan_phi;
 };
 
 } // end of namespace pism
@@ -17,13 +17,15 @@
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <cmath>                // floor
+
 #include "IcebergRemover.hh"
-#include "connected_components.hh"
 #include "pism/util/Mask.hh"
 #include "pism/util/Vars.hh"
 #include "pism/util/error_handling.hh"
 #include "pism/util/IceGrid.hh"
 #include "pism/util/IceModelVec2CellType.hh"
+#include "pism/util/pism_utilities.hh"
 
 namespace pism {
 namespace calving {
@@ -31,8 +33,7 @@ namespace calving {
 IcebergRemover::IcebergRemover(IceGrid::ConstPtr g)
   : Component(g) {
 
-  m_iceberg_mask.create(m_grid, "iceberg_mask", WITHOUT_GHOSTS);
-  m_mask_p0 = m_iceberg_mask.allocate_proc0_copy();
+  m_iceberg_mask.create(m_grid, "iceberg_mask", WITH_GHOSTS);
 }
 
 IcebergRemover::~IcebergRemover() {
@@ -55,49 +56,116 @@ void IcebergRemover::update(const IceModelVec2Int &bc_mask,
     mask_grounded_ice = 1,
     mask_floating_ice = 2;
 
+  // true if the local subdomain contains floating ice
+  double floating = 0.0;
+
   // prepare the mask that will be handed to the connected component
   // labeling code:
   {
-    m_iceberg_mask.set(0.0);
-
     IceModelVec::AccessList list{&mask, &m_iceberg_mask, &bc_mask};
 
-    for (Points p(*m_grid); p; p.next()) {
-      const int i = p.i(), j = p.j();
-
-      if (mask.grounded_ice(i,j) == true) {
-        m_iceberg_mask(i,j) = mask_grounded_ice;
-      } else if (mask.floating_ice(i,j) == true) {
-        m_iceberg_mask(i,j) = mask_floating_ice;
+    const int
+      xs = m_grid->xs(), xm = m_grid->xm(),
+      ys = m_grid->ys(), ym = m_grid->ym();
+
+    // Sweep rows in storage order, classifying each cell once: the cell-type
+    // predicates each re-read and convert the mask value, which adds up in
+    // this whole-grid loop.
+    for (int j = ys; j < ys + ym; j++) {
+      const double
+        *mask_row = mask.row(j),
+        *bc_row   = bc_mask.row(j);
+      double *out_row = m_iceberg_mask.row(j);
+
+      for (int i = xs; i < xs + xm; i++) {
+        const int M = static_cast<int>(floor(mask_row[i] + 0.5));
+
+        // Icy Dirichlet B.C. cells count as "grounded" because we don't want
+        // them removed.
+        if (mask::grounded_ice(M) or (bc_row[i] > 0.5 and mask::icy(M))) {
+          out_row[i] = mask_grounded_ice;
+        } else if (mask::floating_ice(M)) {
+          out_row[i] = mask_floating_ice;
+          floating   = 1.0;
+        } else {
+          out_row[i] = 0.0;
+        }
       }
     }
+  }
 
-    // Mark icy Dirichlet B.C. cells as "grounded" because we don't want them removed.
-    for (Points p(*m_grid); p; p.next()) {
-      const int i = p.i(), j = p.j();
-
-      if (bc_mask(i, j) > 0.5 and mask.icy(i, j)) {
-        m_iceberg_mask(i, j) = mask_grounded_ice;
-      }
-    }
+  // Fast path: without floating ice there cannot be icebergs, so the
+  // iteration below (and the ghost updates at the end) would do nothing.
+  if (GlobalMax(m_grid->com, floating) < 0.5) {
+    return;
   }
 
-  // identify icebergs using serial code on processor 0:
+  // Identify icebergs in parallel: propagate the "attached to grounded ice"
+  // flag from grounded cells through the floating-ice mask. Each pass runs a
+  // forward and a backward sweep over the subdomain (so a flag can cross the
+  // whole subdomain in one pass), then exchanges halos; iteration stops once
+  // no rank makes a change. Communication is proportional to the subdomain
+  // perimeter times the number of passes, and the serial whole-domain
+  // labeling bottleneck on rank 0 is avoided.
   {
-    m_iceberg_mask.put_on_proc0(*m_mask_p0);
-
-    ParallelSection rank0(m_grid->com);
-    try {
-      if (m_grid->rank() == 0) {
-        petsc::VecArray mask_p0(*m_mask_p0);
-        label_connected_components(mask_p0.get(), m_grid->My(), m_grid->Mx(), true, mask_grounded_ice);
+    const int
+      xs = m_grid->xs(), xm = m_grid->xm(),
+      ys = m_grid->ys(), ym = m_grid->ym(),
+      x_last = (int)m_grid->Mx() - 1,
+      y_last = (int)m_grid->My() - 1;
+
+    m_iceberg_mask.update_ghosts();
+
+    double global_changed = 1.0;
+    while (global_changed > 0.5) {
+      double changed = 0.0;
+
+      {
+        IceModelVec::AccessList list{&m_iceberg_mask};
+
+        for (int sweep = 0; sweep < 2; ++sweep) {
+          const int
+            j_first = (sweep == 0) ? ys : ys + ym - 1,
+            j_last  = (sweep == 0) ? ys + ym - 1 : ys,
+            i_first = (sweep == 0) ? xs : xs + xm - 1,
+            i_last  = (sweep == 0) ? xs + xm - 1 : xs,
+            step    = (sweep == 0) ? 1 : -1;
+
+          for (int j = j_first; j != j_last + step; j += step) {
+            for (int i = i_first; i != i_last + step; i += step) {
+
+              if (m_iceberg_mask(i, j) == mask_floating_ice) {
+                // floating ice, not (yet) attached: check the four neighbors,
+                // treating cells outside the domain as ice-free
+                const bool attached =
+                  (i > 0      and m_iceberg_mask(i - 1, j) == mask_grounded_ice) or
+                  (i < x_last and m_iceberg_mask(i + 1, j) == mask_grounded_ice) or
+                  (j > 0      and m_iceberg_mask(i, j - 1) == mask_grounded_ice) or
+                  (j < y_last and m_iceberg_mask(i, j + 1) == mask_grounded_ice);
+
+                if (attached) {
+                  m_iceberg_mask(i, j) = mask_grounded_ice;
+                  changed = 1.0;
+                }
+              }
+            }
+          }
+        }
       }
-    } catch (...) {
-      rank0.failed();
+
+      m_iceberg_mask.update_ghosts();
+
+      global_changed = GlobalMax(m_grid->com, changed);
     }
-    rank0.check();
 
-    m_iceberg_mask.get_from_proc0(*m_mask_p0);
+    // Floating cells that were never attached are icebergs.
+    IceModelVec::AccessList list{&m_iceberg_mask};
+
+    for (Points p(*m_grid); p; p.next()) {
+      const int i = p.i(), j = p.j();
+
+      m_iceberg_mask(i, j) = (m_iceberg_mask(i, j) == mask_floating_ice) ? 1.0 : 0.0;
+    }
   }
 
   // correct ice thickness and the cell type mask using the resulting
@@ -105,12 +173,26 @@ void IcebergRemover::update(const IceModelVec2Int &bc_mask,
   {
     IceModelVec::AccessList list{&ice_thickness, &mask, &m_iceberg_mask, &bc_mask};
 
-    for (Points p(*m_grid); p; p.next()) {
-      const int i = p.i(), j = p.j();
-
-      if (m_iceberg_mask(i,j) > 0.5 && bc_mask(i,j) < 0.5) {
-        ice_thickness(i,j) = 0.0;
-        mask(i,j)     = MASK_ICE_FREE_OCEAN;
+    const int
+      xs = m_grid->xs(), xm = m_grid->xm(),
+      ys = m_grid->ys(), ym = m_grid->ym();
+
+    // Select-style updates instead of conditional stores: iceberg cells are
+    // sparse and scattered, so a per-cell branch here is nearly
+    // unpredictable.
+    for (int j = ys; j < ys + ym; j++) {
+      const double
+        *berg_row = m_iceberg_mask.row(j),
+        *bc_row   = bc_mask.row(j);
+      double
+        *H_row    = ice_thickness.row(j),
+        *mask_row = mask.row(j);
+
+      for (int i = xs; i < xs + xm; i++) {
+        const double remove = (berg_row[i] > 0.5 and bc_row[i] < 0.5) ? 1.0 : 0.0;
+
+        H_row[i]    *= 1.0 - remove;
+        mask_row[i] += remove * (MASK_ICE_FREE_OCEAN - mask_row[i]);
       }
     }
   }
@@ -43,8 +43,10 @@ namespace calving {
  * They are observed to cause unrealistically large velocities that
  * may affect ice velocities elsewhere.
  *
- * This class uses a serial connected component labeling algorithm to
- * remove "icebergs".
+ * Icebergs are identified in parallel: the "attached to grounded ice"
+ * flag is propagated from grounded cells through the floating-ice mask,
+ * exchanging subdomain halos between sweeps until a global fixed point
+ * is reached.
  */
 class IcebergRemover : public Component
 {
@@ -58,7 +60,6 @@ public:
               IceModelVec2S &ice_thickness);
 protected:
   IceModelVec2S m_iceberg_mask;
-  petsc::Vec::Ptr m_mask_p0;
 };
 
 } // end of namespace calving
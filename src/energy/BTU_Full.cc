@@ -216,27 +216,30 @@ void BTU_Full::update_flux_through_top_surface() {
     return;
   }
 
-  double dz = this->vertical_spacing();
+  const double dz = this->vertical_spacing();
   const int k0  = m_Mbz - 1;  // Tb[k0] = ice/bed interface temp, at z=0
 
   IceModelVec::AccessList list{&m_temp, &m_top_surface_flux};
 
   if (m_Mbz >= 3) {
+    // -k / (2 dz), hoisted to keep the division out of the loop
+    const double c = - m_k / (2 * dz);
 
     for (Points p(*m_grid); p; p.next()) {
       const int i = p.i(), j = p.j();
 
       const double *Tb = m_temp.get_column(i, j);
-      m_top_surface_flux(i, j) = - m_k * (3 * Tb[k0] - 4 * Tb[k0-1] + Tb[k0-2]) / (2 * dz);
+      m_top_surface_flux(i, j) = c * (3 * Tb[k0] - 4 * Tb[k0-1] + Tb[k0-2]);
     }
 
   } else {
+    const double c = - m_k / dz;
 
     for (Points p(*m_grid); p; p.next()) {
       const int i = p.i(), j = p.j();
 
       const double *Tb = m_temp.get_column(i, j);
-      m_top_surface_flux(i, j) = - m_k * (Tb[k0] - Tb[k0-1]) / dz;
+      m_top_surface_flux(i, j) = c * (Tb[k0] - Tb[k0-1]);
     }
 
   }
@@ -257,7 +260,7 @@ void BTU_Full::bootstrap(const IceModelVec2S &bedrock_top_temperature) {
                 "  using temperature at the top bedrock surface and geothermal flux\n"
                 "  (bedrock temperature is linear in depth)...\n");
 
-  double dz = this->vertical_spacing();
+  const double dz_over_k = this->vertical_spacing() / m_k;
   const int k0 = m_Mbz - 1; // Tb[k0] = ice/bedrock interface temp
 
   IceModelVec::AccessList list{&bedrock_top_temperature, &m_bottom_surface_flux, &m_temp};
@@ -266,9 +269,12 @@ void BTU_Full::bootstrap(const IceModelVec2S &bedrock_top_temperature) {
 
     double *Tb = m_temp.get_column(i, j); // Tb points into temp memory
 
+    // temperature increment per level, constant within the column
+    const double dT = dz_over_k * m_bottom_surface_flux(i, j);
+
     Tb[k0] = bedrock_top_temperature(i, j);
     for (int k = k0-1; k >= 0; k--) {
-      Tb[k] = Tb[k+1] + dz * m_bottom_surface_flux(i, j) / m_k;
+      Tb[k] = Tb[k+1] + dT;
     }
   }
 
@@ -28,7 +28,8 @@ namespace energy {
 
 BedrockColumn::BedrockColumn(const std::string& prefix,
                              const Config& config, double dz, unsigned int M)
-  : m_dz(dz), m_M(M), m_system(M, prefix) {
+  : m_dz(dz), m_M(M), m_R_cached(-1.0) {
+  (void) prefix;
 
   assert(M > 1);
 
@@ -38,6 +39,9 @@ BedrockColumn::BedrockColumn(const std::string& prefix,
 
   m_k   = config.get_double("energy.bedrock_thermal_conductivity");
   m_D   = m_k / (rho * c);
+
+  m_w.resize(M);
+  m_inv_b.resize(M);
 }
 
 BedrockColumn::~BedrockColumn() {
@@ -61,26 +65,56 @@ void BedrockColumn::solve(double dt, double Q_bottom, double T_top,
   double R = m_D * dt / (m_dz * m_dz);
   double G = -Q_bottom / m_k;
 
-  m_system.L(0)   = 0.0;                 // not used
-  m_system.D(0)   = 1.0 + 2.0 * R;
-  m_system.U(0)   = -2.0 * R;
-  m_system.RHS(0) = T_old[0] - 2.0 * G * m_dz * R;
+  if (R != m_R_cached) {
+    factorize(R);
+  }
+
+  const unsigned int N = m_M - 1;
+
+  // Forward substitution using the cached factorization. Entries of the
+  // lower diagonal are -R except in the last row, where L = 0 and D = 1.
+  T_new[0] = (T_old[0] - 2.0 * G * m_dz * R) * m_inv_b[0];
+  for (unsigned int k = 1; k < N; ++k) {
+    T_new[k] = (T_old[k] + R * T_new[k - 1]) * m_inv_b[k];
+  }
+  T_new[N] = T_top;
+
+  // Back substitution.
+  for (int k = (int)N - 1; k >= 0; --k) {
+    T_new[k] -= m_w[k + 1] * T_new[k + 1];
+  }
+}
 
-  unsigned int N = m_M - 1;
+//! Pre-compute the LU factorization of the system matrix.
+/*!
+  The matrix depends on the time step only (through `R`), so one factorization
+  is shared by all columns in a given update: computing it once removes the
+  forward-elimination divisions from the per-column solve, leaving one
+  multiply-add per level.
+
+  The system is the one assembled by the old per-column code: the first row
+  implements the Neumann condition at the bottom (D = 1 + 2R, U = -2R), the
+  interior rows have (L, D, U) = (-R, 1 + 2R, -R), and the last row is the
+  Dirichlet condition at the top (L = 0, D = 1). Zero pivots cannot occur:
+  the matrix is strictly diagonally dominant for R >= 0.
+*/
+void BedrockColumn::factorize(double R) {
+  const unsigned int N = m_M - 1;
+
+  m_inv_b[0] = 1.0 / (1.0 + 2.0 * R);
 
   for (unsigned int k = 1; k < N; ++k) {
-    m_system.L(k)   = -R;
-    m_system.D(k)   = 1.0 + 2.0 * R;
-    m_system.U(k)   = -R;
-    m_system.RHS(k) = T_old[k];
+    // U is -2R in the first row and -R below it
+    m_w[k]     = (k == 1 ? -2.0 * R : -R) * m_inv_b[k - 1];
+    m_inv_b[k] = 1.0 / ((1.0 + 2.0 * R) + R * m_w[k]);
   }
 
-  m_system.L(N)   = 0.0;
-  m_system.D(N)   = 1.0;
-  m_system.U(N)   = 0.0;                 // not used
-  m_system.RHS(N) = T_top;
+  // last row: L = 0, D = 1. The multiplier stored here scales U of row N-1,
+  // which is the first row (U = -2R) when M == 2.
+  m_w[N]     = (N == 1 ? -2.0 * R : -R) * m_inv_b[N - 1];
+  m_inv_b[N] = 1.0;
 
-  m_system.solve(m_M, T_new);
+  m_R_cached = R;
 }
 
 /*!
@@ -19,7 +19,8 @@
 #ifndef BEDROCK_COLUMN_HH
 #define BEDROCK_COLUMN_HH
 
-#include "pism/util/ColumnSystem.hh"
+#include <string>
+#include <vector>
 
 namespace pism {
 
@@ -50,6 +51,8 @@ public:
              std::vector<double> &result);
 
 private:
+  void factorize(double R);
+
   // temperature diffusivity coefficient
   double m_D;
   // thermal conductivity
@@ -59,7 +62,11 @@ private:
   // system size
   unsigned int m_M;
 
-  TridiagonalSystem m_system;
+  // the value of R = D*dt/dz^2 the cached factorization corresponds to
+  // (negative until the first solve)
+  double m_R_cached;
+  // elimination multipliers and reciprocal pivots of the cached factorization
+  std::vector<double> m_w, m_inv_b;
 };
 
 } // end of namespace energy
@@ -151,15 +151,20 @@ void enthSystemCtx::init(int i, int j, bool marginal, double ice_thickness) {
   temperature with zero water fraction at the corresponding z level.
  */
 void enthSystemCtx::compute_enthalpy_CTS() {
+  const double
+    Es_air  = m_EC->enthalpy_cts(m_p_air),
+    Es_base = m_EC->enthalpy_cts(m_EC->pressure(m_ice_thickness)); // FIXME issue #15
+
+  // Hydrostatic pressure is linear in depth and E_s(p) is linear in p (see
+  // EnthalpyConverter::pressure() and enthalpy_cts()), so E_s is linear in
+  // the level index within the column: evaluating the converter at the base
+  // and the surface is enough.
+  const double dEs = (Es_air - Es_base) * (m_dz / m_ice_thickness);
 
   for (unsigned int k = 0; k <= m_ks; k++) {
-    const double
-      depth = m_ice_thickness - k * m_dz,
-      p = m_EC->pressure(depth); // FIXME issue #15
-    m_Enth_s[k] = m_EC->enthalpy_cts(p);
+    m_Enth_s[k] = Es_base + k * dEs;
   }
 
-  const double Es_air = m_EC->enthalpy_cts(m_p_air);
   for (unsigned int k = m_ks+1; k < m_Enth_s.size(); k++) {
     m_Enth_s[k] = Es_air;
   }
@@ -59,8 +59,10 @@ void compute_enthalpy_cold(const IceModelVec3 &temperature,
     const double *Tij = temperature.get_column(i,j);
     double *Enthij = result.get_column(i,j);
 
+    const double H = ice_thickness(i, j);
+
     for (unsigned int k = 0; k < Mz; ++k) {
-      const double depth = ice_thickness(i, j) - z[k]; // FIXME issue #15
+      const double depth = H - z[k]; // FIXME issue #15
       Enthij[k] = EC->enthalpy_permissive(Tij[k], 0.0, EC->pressure(depth));
     }
   }
@@ -122,8 +124,10 @@ void compute_enthalpy(const IceModelVec3 &temperature,
     const double *omega = liquid_water_fraction.get_column(i,j);
     double       *E     = result.get_column(i,j);
 
+    const double H = ice_thickness(i, j);
+
     for (unsigned int k = 0; k < Mz; ++k) {
-      const double depth = ice_thickness(i,j) - z[k]; // FIXME issue #15
+      const double depth = H - z[k]; // FIXME issue #15
       E[k] = EC->enthalpy_permissive(T[k], omega[k], EC->pressure(depth));
     }
   }
@@ -158,8 +162,10 @@ void compute_liquid_water_fraction(const IceModelVec3 &enthalpy,
       const double *Enthij = enthalpy.get_column(i,j);
       double *omegaij = result.get_column(i,j);
 
+      const double H = ice_thickness(i, j);
+
       for (unsigned int k=0; k < grid->Mz(); ++k) {
-        const double depth = ice_thickness(i,j) - grid->z(k); // FIXME issue #15
+        const double depth = H - grid->z(k); // FIXME issue #15
         omegaij[k] = EC->water_fraction(Enthij[k],EC->pressure(depth));
       }
     }
@@ -202,8 +208,10 @@ void compute_cts(const IceModelVec3 &ice_enthalpy,
     double *CTS  = result.get_column(i,j);
     const double *enthalpy = ice_enthalpy.get_column(i,j);
 
+    const double H = ice_thickness(i, j);
+
     for (unsigned int k = 0; k < Mz; ++k) {
-      const double depth = ice_thickness(i,j) - z[k]; // FIXME issue #15
+      const double depth = H - z[k]; // FIXME issue #15
       CTS[k] = enthalpy[k] / EC->enthalpy_cts(EC->pressure(depth));
     }
   }
@@ -391,7 +399,9 @@ void bootstrap_ice_temperature(const IceModelVec2S &ice_thickness,
 
       double *T = result.get_column(i, j);
 
-      // within ice
+      // Within the ice: fill the column, checking that resulting temperatures
+      // are not too low as they are computed (a separate validation pass would
+      // re-read the whole column).
       if (use_smb) { // method 1:  includes surface mass balance in estimate
 
         // Convert SMB from "kg m-2 s-1" to "m second-1".
@@ -400,6 +410,12 @@ void bootstrap_ice_temperature(const IceModelVec2S &ice_thickness,
         for (unsigned int k = 0; k < ks; k++) {
           const double z = grid->z(k);
           T[k] = ice_temperature_guess_smb(EC, H, z, T_surface, G, ice_k, K, SMB);
+
+          if (T[k] < T_min) {
+            throw RuntimeError::formatted(PISM_ERROR_LOCATION,
+                                          "T(%d,%d,%d) = %f < T_min = %f Kelvin",
+                                          i, j, k, T[k], T_min);
+          }
         }
 
       } else { // method 2: a quartic guess; does not use SMB
@@ -407,17 +423,14 @@ void bootstrap_ice_temperature(const IceModelVec2S &ice_thickness,
         for (unsigned int k = 0; k < ks; k++) {
           const double z = grid->z(k);
           T[k] = ice_temperature_guess(EC, H, z, T_surface, G, ice_k);
-        }
 
-      }
-
-      // Make sure that resulting temperatures are not too low.
-      for (unsigned int k = 0; k < ks; k++) {
-        if (T[k] < T_min) {
-          throw RuntimeError::formatted(PISM_ERROR_LOCATION,
-                                        "T(%d,%d,%d) = %f < T_min = %f Kelvin",
-                                        i, j, k, T[k], T_min);
+          if (T[k] < T_min) {
+            throw RuntimeError::formatted(PISM_ERROR_LOCATION,
+                                          "T(%d,%d,%d) = %f < T_min = %f Kelvin",
+                                          i, j, k, T[k], T_min);
+          }
         }
+
       }
 
       // above ice
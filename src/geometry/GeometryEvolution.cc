@@ -837,28 +837,29 @@ void GeometryEvolution::residual_redistribution_iteration(const IceModelVec2S  &
     for (Points p(*m_grid); p; p.next()) {
       const int i = p.i(), j = p.j();
 
-      if (residual(i, j) <= 0.0) {
+      const double R = residual(i, j);
+
+      if (R <= 0.0) {
         continue;
       }
 
       StarStencil<int> m = cell_type.int_star(i, j);
 
-      int N = 0; // number of empty or partially filled neighbors
+      // number of empty or partially filled neighbors, counted without
+      // branching on the (unpredictable) pattern of the shelf front
+      int N = 0;
       for (unsigned int n = 0; n < 4; ++n) {
-        const Direction direction = directions[n];
-        if (ice_free_ocean(m[direction])) {
-          N++;
-        }
+        N += static_cast<int>(ice_free_ocean(m[directions[n]]));
       }
 
       if (N > 0)  {
         // Remaining ice mass will be redistributed equally among all adjacent
         // ice-free-ocean cells (is there a more physical way?)
-        residual(i, j) /= N;
+        residual(i, j) = R / N;
       } else {
         // Conserve mass, but (possibly) create a "ridge" at the shelf
         // front
-        ice_thickness(i, j) += residual(i, j);
+        ice_thickness(i, j) += R;
         residual(i, j) = 0.0;
       }
     }
@@ -899,13 +900,15 @@ void GeometryEvolution::residual_redistribution_iteration(const IceModelVec2S  &
   // neighbors which gained redistributed ice also become full.
   {
     // will be destroyed at the end of the block
-    IceModelVec::AccessList list{&m_impl->thickness, &ice_thickness,
-        &ice_surface_elevation, &bed_topography, &cell_type};
+    IceModelVec::AccessList list{&m_impl->thickness, &ice_thickness, &area_specific_volume,
+        &residual, &ice_surface_elevation, &bed_topography, &cell_type};
 
     for (Points p(*m_grid); p; p.next()) {
       const int i = p.i(), j = p.j();
 
-      if (area_specific_volume(i, j) <= 0.0) {
+      const double V = area_specific_volume(i, j);
+
+      if (V <= 0.0) {
         continue;
       }
 
@@ -917,15 +920,17 @@ void GeometryEvolution::residual_redistribution_iteration(const IceModelVec2S  &
       // if threshold is zero, turn all the area specific volume into ice thickness, with zero
       // residual
       if (threshold == 0.0) {
-        threshold = area_specific_volume(i, j);
+        threshold = V;
       }
 
-      if (area_specific_volume(i, j) >= threshold) {
+      if (V >= threshold) {
+        const double R = V - threshold;
+
         ice_thickness(i, j)        += threshold;
-        residual(i, j)              = area_specific_volume(i, j) - threshold;
+        residual(i, j)              = R;
         area_specific_volume(i, j)  = 0.0;
 
-        remaining_residual += residual(i, j);
+        remaining_residual += R;
       }
     }
   }
@@ -40,14 +40,17 @@ double part_grid_threshold_thickness(StarStencil<int> M,
     H_threshold = 0.0;
   int N = 0;
 
+  // Accumulate without branching: this is called at the calving front, where
+  // the icy/ice-free pattern of the neighborhood is essentially unpredictable.
+  // Adding W * x with W in {0, 1} is exact, so results are unchanged.
   const Direction dirs[] = {North, East, South, West};
   for (int n = 0; n < 4; ++n) {
     Direction direction = dirs[n];
-    if (mask::icy(M[direction])) {
-      H_average += H[direction];
-      h_average += h[direction];
-      N++;
-    }
+    const int W = static_cast<int>(mask::icy(M[direction]));
+
+    H_average += W * H[direction];
+    h_average += W * h[direction];
+    N         += W;
   }
 
   if (N == 0) {
@@ -340,29 +340,29 @@ void Distributed::update_impl(double t, double dt, const Inputs& inputs) {
     bool enforce_upper = (step_counter == 1);
     check_P_bounds(m_P, m_Pover, enforce_upper);
 
-    water_thickness_staggered(m_W,
-                              *inputs.cell_type,
-                              m_Wstag);
+    // the water pressure evolves in this model, so the hydraulic potential
+    // R = P + rhow g b and the gradient-power factor have to be refreshed
+    // every sub-step
+    subglacial_water_pressure().add(m_rg, *inputs.bed_elevation, m_R); // updates ghosts
+    compute_conductivity_gradient_factor(m_R, m_grad_factor);
 
     double maxKW = 0.0;
-    compute_conductivity(m_Wstag,
-                         subglacial_water_pressure(),
-                         *inputs.bed_elevation,
-                         m_K, maxKW);
-
-    compute_velocity(m_Wstag,
-                     subglacial_water_pressure(),
-                     *inputs.bed_elevation,
-                     m_K,
-                     inputs.no_model_mask,
-                     m_V);
+    water_thickness_and_conductivity_staggered(m_W,
+                                               *inputs.cell_type,
+                                               m_grad_factor,
+                                               m_Wstag,
+                                               m_K,
+                                               maxKW);
+
+    std::vector<double> V_absmax;
+    compute_velocity(m_Wstag, m_R, m_K, inputs.no_model_mask, m_V, V_absmax);
 
     // to get Q, W needs valid ghosts
     advective_fluxes(m_V, m_W, m_Q);
 
     {
       const double
-        dt_cfl    = max_timestep_W_cfl(),
+        dt_cfl    = max_timestep_W_cfl(V_absmax),
         dt_diff_w = max_timestep_W_diff(maxKW),
         dt_diff_p = max_timestep_P_diff(phi0, dt_diff_w);
 
@@ -16,6 +16,8 @@
 // along with PISM; if not, write to the Free Software
 // Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
+#include <cmath>                // floor, fmin, fmax
+
 #include "Hydrology.hh"
 #include "pism/util/Mask.hh"
 #include "pism/util/Vars.hh"
@@ -642,29 +644,50 @@ void Hydrology::enforce_bounds(const IceModelVec2CellType &cell_type,
     fresh_water_density = m_config->get_double("constants.fresh_water.density"),
     kg_per_m            = m_grid->cell_area() * fresh_water_density; // kg m-1
 
-  for (Points p(*m_grid); p; p.next()) {
-    const int i = p.i(), j = p.j();
-
-    if (water_thickness(i, j) < 0.0) {
-      conservation_error_change(i, j) += -water_thickness(i, j) * kg_per_m;
-      water_thickness(i, j) = 0.0;
-    }
+  const bool limit_thickness = max_thickness > 0.0;
+
+  const int
+    xs = m_grid->xs(), xm = m_grid->xm(),
+    ys = m_grid->ys(), ym = m_grid->ym();
+
+  // Row-ordered sweep using selects instead of per-cell branches: the mask
+  // pattern near margins is unpredictable, and this form vectorizes.
+  for (int j = ys; j < ys + ym; j++) {
+    const double *mask_row = cell_type.row(j);
+    double
+      *W_row   = water_thickness.row(j),
+      *gm_row  = grounded_margin_change.row(j),
+      *gl_row  = grounding_line_change.row(j),
+      *err_row = conservation_error_change.row(j);
+
+    for (int i = xs; i < xs + xm; i++) {
+      double W = W_row[i];
+
+      // clip from below, charging the deficit to the conservation error
+      const double deficit = std::fmin(W, 0.0);
+      err_row[i] += -deficit * kg_per_m;
+      W -= deficit;
+
+      // clip from above (if a limit is active), with the same accounting
+      if (limit_thickness) {
+        const double excess = std::fmax(W - max_thickness, 0.0);
+        err_row[i] += -excess * kg_per_m;
+        W -= excess;
+      }
 
-    if (max_thickness > 0.0 and water_thickness(i, j) > max_thickness) {
-      double excess = water_thickness(i, j) - max_thickness;
+      const int M = static_cast<int>(floor(mask_row[i] + 0.5));
 
-      conservation_error_change(i, j) += -excess * kg_per_m;
-      water_thickness(i, j) = max_thickness;
-    }
+      // remove water on ice-free land and in the ocean, charging the
+      // corresponding accounts
+      const double land = mask::ice_free_land(M) ? 1.0 : 0.0;
+      gm_row[i] += -W * kg_per_m * land;
+      W *= 1.0 - land;
 
-    if (cell_type.ice_free_land(i, j)) {
-      grounded_margin_change(i, j) += -water_thickness(i, j) * kg_per_m;
-      water_thickness(i, j) = 0.0;
-    }
+      const double ocean = mask::ocean(M) ? 1.0 : 0.0;
+      gl_row[i] += -W * kg_per_m * ocean;
+      W *= 1.0 - ocean;
 
-    if (cell_type.ocean(i, j)) {
-      grounding_line_change(i, j) += -water_thickness(i, j) * kg_per_m;
-      water_thickness(i, j) = 0.0;
+      W_row[i] = W;
     }
   }
 
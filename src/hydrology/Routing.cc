@@ -17,6 +17,7 @@
 // Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include <cassert>
+#include <cmath>                // fabs, pow
 
 #include "Routing.hh"
 #include "pism/util/IceModelVec2CellType.hh"
@@ -221,6 +222,13 @@ Routing::Routing(IceGrid::ConstPtr g)
 
   // auxiliary variables which do not need ghosts
 
+  m_grad_factor.create(m_grid, "conductivity_gradient_factor", WITHOUT_GHOSTS);
+  m_grad_factor.set_attrs("internal",
+                          "cell face-centered (staggered) values of the gradient factor"
+                          " in the nonlinear conductivity",
+                          "", "");
+  m_grad_factor.metadata().set_double("valid_min", 0.0);
+
   m_V.create(m_grid, "water_velocity", WITHOUT_GHOSTS);
   m_V.set_attrs("internal",
                 "cell face-centered (staggered) components of water velocity"
@@ -331,145 +339,166 @@ void Routing::compute_hydraulic_potential(const IceModelVec2S &W,
 }
 
 
-//! Average the regular grid water thickness to values at the center of cell edges.
-/*! Uses mask values to avoid averaging using water thickness values from
-  either ice-free or floating areas. */
-void Routing::water_thickness_staggered(const IceModelVec2S &W,
-                                        const IceModelVec2CellType &mask,
-                                        IceModelVec2Stag &result) {
+//! Compute the staggered-grid water thickness and the nonlinear conductivity in one sweep.
+/*!
+  Averages the regular grid water thickness to values at the center of cell
+  edges, using mask values to avoid averaging using water thickness values
+  from either ice-free or floating areas, and computes the conductivity
+
+  \f[ K = k W^{\alpha-1} |\nabla R|^{\beta-2} \f]
+
+  at the same edges. The gradient-power factor \f$|\nabla R|^{\beta-2}\f$
+  must be supplied in `grad_factor` (see
+  compute_conductivity_gradient_factor()); it is not used if \f$\beta = 2\f$.
+
+  The conductivity needs only the local staggered thickness, so producing
+  both fields in one pass streams W through the cache once instead of twice.
+
+  Also returns the maximum over all staggered points of \f$ K W \f$.
+*/
+void Routing::water_thickness_and_conductivity_staggered(const IceModelVec2S &W,
+                                                         const IceModelVec2CellType &mask,
+                                                         const IceModelVec2Stag &grad_factor,
+                                                         IceModelVec2Stag &W_stag,
+                                                         IceModelVec2Stag &K,
+                                                         double &KW_max) {
+  const double
+    k     = m_config->get_double("hydrology.hydraulic_conductivity"),
+    alpha = m_config->get_double("hydrology.thickness_power_in_flux"),
+    beta  = m_config->get_double("hydrology.gradient_power_in_flux");
+
+  // W enters the conductivity with the power alpha - 1
+  const double exponent = alpha - 1.0;
+
+  const bool use_grad_factor = (beta != 2.0);
+
+  IceModelVec::AccessList list{ &mask, &W, &W_stag, &K };
+
+  if (use_grad_factor) {
+    list.add(grad_factor);
+  }
 
-  IceModelVec::AccessList list{ &mask, &W, &result };
+  KW_max = 0.0;
 
   for (Points p(*m_grid); p; p.next()) {
     const int i = p.i(), j = p.j();
 
+    double W_edge[2];
+
     // east
     if (mask.grounded_ice(i, j)) {
       if (mask.grounded_ice(i + 1, j)) {
-        result(i, j, 0) = 0.5 * (W(i, j) + W(i + 1, j));
+        W_edge[0] = 0.5 * (W(i, j) + W(i + 1, j));
       } else {
-        result(i, j, 0) = W(i, j);
+        W_edge[0] = W(i, j);
       }
     } else {
       if (mask.grounded_ice(i + 1, j)) {
-        result(i, j, 0) = W(i + 1, j);
+        W_edge[0] = W(i + 1, j);
       } else {
-        result(i, j, 0) = 0.0;
+        W_edge[0] = 0.0;
       }
     }
     // north
     if (mask.grounded_ice(i, j)) {
       if (mask.grounded_ice(i, j + 1)) {
-        result(i, j, 1) = 0.5 * (W(i, j) + W(i, j + 1));
+        W_edge[1] = 0.5 * (W(i, j) + W(i, j + 1));
       } else {
-        result(i, j, 1) = W(i, j);
+        W_edge[1] = W(i, j);
       }
     } else {
       if (mask.grounded_ice(i, j + 1)) {
-        result(i, j, 1) = W(i, j + 1);
+        W_edge[1] = W(i, j + 1);
+      } else {
+        W_edge[1] = 0.0;
+      }
+    }
+
+    for (int o = 0; o < 2; ++o) {
+      double K_edge;
+      if (exponent == 0.0) {
+        // alpha = 1: the conductivity does not depend on W
+        K_edge = k;
+      } else if (exponent == 0.25) {
+        // the default alpha = 5/4: W^{1/4} is two square roots, much cheaper
+        // than the general pow()
+        K_edge = k * sqrt(sqrt(W_edge[o]));
       } else {
-        result(i, j, 1) = 0.0;
+        K_edge = k * pow(W_edge[o], exponent);
       }
+
+      if (use_grad_factor) {
+        K_edge *= grad_factor(i, j, o);
+      }
+
+      W_stag(i, j, o) = W_edge[o];
+      K(i, j, o)      = K_edge;
+
+      KW_max = std::max(KW_max, K_edge * W_edge[o]);
     }
   }
 
-  result.update_ghosts();
+  KW_max = GlobalMax(m_grid->com, KW_max);
+
+  W_stag.update_ghosts();
+  K.update_ghosts();
 }
 
 
-//! Compute the nonlinear conductivity at the center of cell edges.
+//! Compute the gradient-power factor of the conductivity at the center of cell edges.
 /*!
   Computes
 
-  \f[ K = K(W, \nabla P, \nabla b) = k W^{\alpha-1} |\nabla R|^{\beta-2} \f]
+  \f[ B = (\Pi + \epsilon^2)^{(\beta-2)/2}, \qquad \Pi = |\nabla R|^2 \f]
 
-  on the staggered grid, where \f$R = P+\rho_w g b\f$.  We denote
+  on the staggered grid, where \f$R = P+\rho_w g b\f$ is the simplified
+  hydraulic potential. \f$\Pi\f$ is computed by a Mahaffy-like ([@ref Mahaffy])
+  scheme; this requires \f$R\f$ to be defined on a box stencil of width 1.
 
-  \f[ \Pi = |\nabla R|^2 \f]
+  \f$B\f$ does not depend on the water amount, so whenever the water pressure
+  is fixed during a hydrology update (as in this model, where it is the
+  overburden pressure) this factor can be computed once per update instead of
+  once per sub-step; see update_impl().
 
-  internally; this is computed on a staggered grid by a Mahaffy-like ([@ref Mahaffy])
-  scheme. This requires \f$R\f$ to be defined on a box stencil of width 1.
+  `R` is the simplified hydraulic potential \f$P + \rho_w g b\f$ and must
+  have valid ghosts.
 
-  Also returns the maximum over all staggered points of \f$ K W \f$.
+  Does nothing if \f$\beta = 2\f$: the factor is identically 1 in that case
+  and water_thickness_and_conductivity_staggered() does not read it.
 */
-void Routing::compute_conductivity(const IceModelVec2Stag &W,
-                                   const IceModelVec2S &P,
-                                   const IceModelVec2S &bed_elevation,
-                                   IceModelVec2Stag &result,
-                                   double &KW_max) const {
+void Routing::compute_conductivity_gradient_factor(const IceModelVec2S &R,
+                                                   IceModelVec2Stag &result) const {
   const double
-    k     = m_config->get_double("hydrology.hydraulic_conductivity"),
-    alpha = m_config->get_double("hydrology.thickness_power_in_flux"),
-    beta  = m_config->get_double("hydrology.gradient_power_in_flux"),
+    beta    = m_config->get_double("hydrology.gradient_power_in_flux"),
     betapow = (beta - 2.0) / 2.0;
 
-  IceModelVec::AccessList list({&result, &W});
-
-  KW_max = 0.0;
-
-  if (beta != 2.0) {
-    // Put the squared norm of the gradient of the simplified hydrolic potential (Pi) in
-    // "result"
-    //
-    // FIXME: we don't need to re-compute this during every hydrology time step: the
-    // simplified hydrolic potential does not depend on the water amount and can be
-    // computed *once* in update_impl(), before entering the time-stepping loop
-    {
-      // R  <-- P + rhow g b
-      P.add(m_rg, bed_elevation, m_R);  // yes, it updates ghosts
-
-      list.add(m_R);
-      for (Points p(*m_grid); p; p.next()) {
-        const int i = p.i(), j = p.j();
-
-        double dRdx, dRdy;
-        dRdx = (m_R(i + 1, j) - m_R(i, j)) / m_dx;
-        dRdy = (m_R(i + 1, j + 1) + m_R(i, j + 1) - m_R(i + 1, j - 1) - m_R(i, j - 1)) / (4.0 * m_dy);
-        result(i, j, 0) = dRdx * dRdx + dRdy * dRdy;
-
-        dRdx = (m_R(i + 1, j + 1) + m_R(i + 1, j) - m_R(i - 1, j + 1) - m_R(i - 1, j)) / (4.0 * m_dx);
-        dRdy = (m_R(i, j + 1) - m_R(i, j)) / m_dy;
-        result(i, j, 1) = dRdx * dRdx + dRdy * dRdy;
-      }
-    }
-
-    // We regularize negative power |\grad psi|^{beta-2} by adding eps because large
-    // head gradient might be 10^7 Pa per 10^4 m or 10^3 Pa/m.
-    const double eps = beta < 2.0 ? 1.0 : 0.0;
-
-    for (Points p(*m_grid); p; p.next()) {
-      const int i = p.i(), j = p.j();
+  if (beta == 2.0) {
+    return;
+  }
 
-      for (int o = 0; o < 2; ++o) {
-        const double Pi = result(i, j, o);
+  // We regularize negative power |\grad psi|^{beta-2} by adding eps because large
+  // head gradient might be 10^7 Pa per 10^4 m or 10^3 Pa/m.
+  const double eps = beta < 2.0 ? 1.0 : 0.0;
 
-        // FIXME: same as Pi above: we don't need to re-compute this each time we make a
-        // short hydrology time step
-        double B = pow(Pi + eps * eps, betapow);
+  IceModelVec::AccessList list({&R, &result});
 
-        result(i, j, o) = k * pow(W(i, j, o), alpha - 1.0) * B;
+  for (Points p(*m_grid); p; p.next()) {
+    const int i = p.i(), j = p.j();
 
-        KW_max = std::max(KW_max, result(i, j, o) * W(i, j, o));
-      }
-    }
-  } else {
-    for (Points p(*m_grid); p; p.next()) {
-      const int i = p.i(), j = p.j();
+    double dRdx, dRdy;
+    dRdx = (R(i + 1, j) - R(i, j)) / m_dx;
+    dRdy = (R(i + 1, j + 1) + R(i, j + 1) - R(i + 1, j - 1) - R(i, j - 1)) / (4.0 * m_dy);
+    const double Pi_x = dRdx * dRdx + dRdy * dRdy;
 
-      for (int o = 0; o < 2; ++o) {
-        result(i, j, o) = k * pow(W(i, j, o), alpha - 1.0);
+    dRdx = (R(i + 1, j + 1) + R(i + 1, j) - R(i - 1, j + 1) - R(i - 1, j)) / (4.0 * m_dx);
+    dRdy = (R(i, j + 1) - R(i, j)) / m_dy;
+    const double Pi_y = dRdx * dRdx + dRdy * dRdy;
 
-        KW_max = std::max(KW_max, result(i, j, o) * W(i, j, o));
-      }
-    }
+    result(i, j, 0) = pow(Pi_x + eps * eps, betapow);
+    result(i, j, 1) = pow(Pi_y + eps * eps, betapow);
   }
-
-  KW_max = GlobalMax(m_grid->com, KW_max);
-
-  result.update_ghosts();
 }
 
-
 //! Compute the wall melt rate which comes from (turbulent) dissipation of flow energy.
 /*!
   This code fills `result` with
@@ -559,65 +588,74 @@ void wall_melt(const Routing &model,
 
   The advection velocity is given by the formula
 
-  @f[ \mathbf{V} = - K \left(\nabla P + \rho_w g \nabla b\right) @f]
+  @f[ \mathbf{V} = - K \nabla R = - K \left(\nabla P + \rho_w g \nabla b\right) @f]
 
-  where @f$\mathbf{V}@f$ is the water velocity, @f$P@f$ is the water
-  pressure, and @f$b@f$ is the bedrock elevation.
+  where @f$\mathbf{V}@f$ is the water velocity and @f$R = P + \rho_w g b@f$
+  is the simplified hydraulic potential, which must have valid ghosts (see
+  update_impl(); combining @f$P@f$ and @f$b@f$ ahead of time halves the reads
+  in this sweep and avoids re-copying the pressure into ghosted storage every
+  sub-step).
 
   If the corresponding staggered grid value of the water thickness is zero then that
   component of V is set to zero. This does not change the flux value (which would be zero
-  anyway) but it does provide the correct max velocity in the CFL calculation. We assume
-  bed has valid ghosts.
+  anyway) but it does provide the correct max velocity in the CFL calculation.
+
+  Also returns, in `V_absmax`, the maximum absolute value of each velocity
+  component over the whole grid (a global reduction): accumulating the maxima
+  here saves the separate full-grid pass max_timestep_W_cfl() used to make.
 */
 void Routing::compute_velocity(const IceModelVec2Stag &W,
-                               const IceModelVec2S &P,
-                               const IceModelVec2S &bed,
+                               const IceModelVec2S &R,
                                const IceModelVec2Stag &K,
                                const IceModelVec2Int *no_model_mask,
-                               IceModelVec2Stag &result) const {
-  double dbdx, dbdy, dPdx, dPdy;
+                               IceModelVec2Stag &result,
+                               std::vector<double> &V_absmax) const {
+
+  IceModelVec::AccessList list{&R, &W, &K, &result};
 
-  IceModelVec2S &pressure = m_R;
-  pressure.copy_from(P);  // yes, it updates ghosts
+  if (no_model_mask) {
+    list.add(*no_model_mask);
+  }
 
-  IceModelVec::AccessList list{&pressure, &W, &K, &bed, &result};
+  double u_max = 0.0, v_max = 0.0;
 
   for (Points p(*m_grid); p; p.next()) {
     const int i = p.i(), j = p.j();
 
+    double u = 0.0, v = 0.0;
+
     if (W(i, j, 0) > 0.0) {
-      dPdx = (pressure(i + 1, j) - pressure(i, j)) / m_dx;
-      dbdx = (bed(i + 1, j) - bed(i, j)) / m_dx;
-      result(i, j, 0) =  - K(i, j, 0) * (dPdx + m_rg * dbdx);
-    } else {
-      result(i, j, 0) = 0.0;
+      const double dRdx = (R(i + 1, j) - R(i, j)) / m_dx;
+      u = - K(i, j, 0) * dRdx;
     }
 
     if (W(i, j, 1) > 0.0) {
-      dPdy = (pressure(i, j + 1) - pressure(i, j)) / m_dy;
-      dbdy = (bed(i, j + 1) - bed(i, j)) / m_dy;
-      result(i, j, 1) =  - K(i, j, 1) * (dPdy + m_rg * dbdy);
-    } else {
-      result(i, j, 1) = 0.0;
+      const double dRdy = (R(i, j + 1) - R(i, j)) / m_dy;
+      v = - K(i, j, 1) * dRdy;
     }
-  }
-
-  if (no_model_mask) {
-    const IceModelVec2Int &M = *no_model_mask;
-    list.add(M);
 
-    for (Points p(*m_grid); p; p.next()) {
-      const int i = p.i(), j = p.j();
+    if (no_model_mask) {
+      const IceModelVec2Int &M = *no_model_mask;
 
       if (M(i, j) or M(i + 1, j)) {
-        result(i, j, 0) = 0.0;
+        u = 0.0;
       }
 
       if (M(i, j) or M(i, j + 1)) {
-        result(i, j, 1) = 0.0;
+        v = 0.0;
       }
     }
+
+    result(i, j, 0) = u;
+    result(i, j, 1) = v;
+
+    u_max = std::max(u_max, fabs(u));
+    v_max = std::max(v_max, fabs(v));
   }
+
+  V_absmax.resize(2);
+  V_absmax[0] = GlobalMax(m_grid->com, u_max);
+  V_absmax[1] = GlobalMax(m_grid->com, v_max);
 }
 
 
@@ -656,11 +694,10 @@ double Routing::max_timestep_W_diff(double KW_max) const {
 /*!
  * See equation (50) in Bueler and van Pelt.
  */
-double Routing::max_timestep_W_cfl() const {
-  // V could be zero if P is constant and bed is flat
-  std::vector<double> tmp = m_V.absmaxcomponents();
-
-  return 0.5 / (tmp[0]/m_dx + tmp[1]/m_dy); // FIXME: is regularization needed?
+double Routing::max_timestep_W_cfl(const std::vector<double> &V_absmax) const {
+  // V could be zero if P is constant and bed is flat; V_absmax is computed
+  // during the velocity sweep (see compute_velocity())
+  return 0.5 / (V_absmax[0]/m_dx + V_absmax[1]/m_dy); // FIXME: is regularization needed?
 }
 
 
@@ -787,6 +824,13 @@ void Routing::update_impl(double t, double dt, const Inputs& inputs) {
   // make sure W has valid ghosts before starting hydrology steps
   m_W.update_ghosts();
 
+  // In this model the water pressure is the overburden pressure, which does
+  // not change during the sub-steps below: the simplified hydraulic
+  // potential R = P + rhow g b and the gradient-power factor of the
+  // conductivity can both be computed once per update.
+  subglacial_water_pressure().add(m_rg, *inputs.bed_elevation, m_R); // updates ghosts
+  compute_conductivity_gradient_factor(m_R, m_grad_factor);
+
   unsigned int step_counter = 0;
   for (; ht < t_final; ht += hdt) {
     step_counter++;
@@ -798,29 +842,23 @@ void Routing::update_impl(double t, double dt, const Inputs& inputs) {
     check_bounds(m_Wtill, m_config->get_double("hydrology.tillwat_max"));
 #endif
 
-    water_thickness_staggered(m_W,
-                              *inputs.cell_type,
-                              m_Wstag);
-
     double maxKW = 0.0;
-    compute_conductivity(m_Wstag,
-                         subglacial_water_pressure(),
-                         *inputs.bed_elevation,
-                         m_K, maxKW);
-
-    compute_velocity(m_Wstag,
-                     subglacial_water_pressure(),
-                     *inputs.bed_elevation,
-                     m_K,
-                     inputs.no_model_mask,
-                     m_V);
+    water_thickness_and_conductivity_staggered(m_W,
+                                               *inputs.cell_type,
+                                               m_grad_factor,
+                                               m_Wstag,
+                                               m_K,
+                                               maxKW);
+
+    std::vector<double> V_absmax;
+    compute_velocity(m_Wstag, m_R, m_K, inputs.no_model_mask, m_V, V_absmax);
 
     // to get Q, W needs valid ghosts
     advective_fluxes(m_V, m_W, m_Q);
 
     {
       const double
-        dt_cfl    = max_timestep_W_cfl(),
+        dt_cfl    = max_timestep_W_cfl(V_absmax),
         dt_diff_w = max_timestep_W_diff(maxKW);
 
       hdt = std::min(t_final - ht, dt_max);
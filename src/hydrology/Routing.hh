@@ -107,7 +107,7 @@ protected:
   virtual void write_model_state_impl(const PIO &output) const;
 
   double max_timestep_W_diff(double KW_max) const;
-  double max_timestep_W_cfl() const;
+  double max_timestep_W_cfl(const std::vector<double> &V_absmax) const;
 protected:
 
   // this model's auxiliary variables
@@ -119,18 +119,28 @@ protected:
   // edge-centered (staggered) values of nonlinear conductivity
   IceModelVec2Stag m_K;
 
+  // edge-centered (staggered) values of the gradient-power factor
+  // |grad(P + rhow g b)|^{beta-2} entering the conductivity; does not depend
+  // on the water amount (see compute_conductivity_gradient_factor())
+  IceModelVec2Stag m_grad_factor;
+
   // edge-centered (staggered) advection fluxes
   IceModelVec2Stag m_Q;
 
   // work space
   IceModelVec2S m_Wnew, m_Wtillnew;
 
-  // ghosted temporary storage; modified in compute_conductivity and compute_velocity
+  // ghosted storage for the simplified hydraulic potential
+  // R = P + rhow g b; refreshed whenever the water pressure may have changed
+  // (see update_impl())
   mutable IceModelVec2S m_R;
 
-  void water_thickness_staggered(const IceModelVec2S &W,
-                                 const IceModelVec2CellType &mask,
-                                 IceModelVec2Stag &result);
+  void water_thickness_and_conductivity_staggered(const IceModelVec2S &W,
+                                                  const IceModelVec2CellType &mask,
+                                                  const IceModelVec2Stag &grad_factor,
+                                                  IceModelVec2Stag &W_stag,
+                                                  IceModelVec2Stag &K,
+                                                  double &KW_max);
 
   void compute_hydraulic_potential(const IceModelVec2S &W,
                                    const IceModelVec2S &P,
@@ -139,18 +149,15 @@ protected:
                                    const IceModelVec2CellType &mask,
                                    IceModelVec2S &result) const;
 
-  void compute_conductivity(const IceModelVec2Stag &W,
-                            const IceModelVec2S &P,
-                            const IceModelVec2S &bed,
-                            IceModelVec2Stag &result,
-                            double &maxKW) const;
+  void compute_conductivity_gradient_factor(const IceModelVec2S &R,
+                                            IceModelVec2Stag &result) const;
 
   void compute_velocity(const IceModelVec2Stag &W,
-                        const IceModelVec2S &P,
-                        const IceModelVec2S &bed,
+                        const IceModelVec2S &R,
                         const IceModelVec2Stag &K,
                         const IceModelVec2Int *no_model_mask,
-                        IceModelVec2Stag &result) const;
+                        IceModelVec2Stag &result,
+                        std::vector<double> &V_absmax) const;
 
   void advective_fluxes(const IceModelVec2Stag &V,
                         const IceModelVec2S &W,
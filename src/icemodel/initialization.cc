@@ -381,15 +381,14 @@ void IceModel::bootstrap_2d(const PIO &input_file) {
 
   m_geometry.ice_thickness.regrid(input_file, OPTIONAL,
                                   m_config->get_double("bootstrapping.defaults.ice_thickness"));
-  // check the range of the ice thickness
-  {
-    Range thk_range = m_geometry.ice_thickness.range();
+  // Check the range of the ice thickness. (Computing the range requires a collective
+  // reduction, so do it once and re-use the result below.)
+  Range thk_range = m_geometry.ice_thickness.range();
 
-    if (thk_range.max >= m_grid->Lz() + 1e-6) {
-      throw RuntimeError::formatted(PISM_ERROR_LOCATION, "Maximum ice thickness (%f meters)\n"
-                                    "exceeds the height of the computational domain (%f meters).",
-                                    thk_range.max, m_grid->Lz());
-    }
+  if (thk_range.max >= m_grid->Lz() + 1e-6) {
+    throw RuntimeError::formatted(PISM_ERROR_LOCATION, "Maximum ice thickness (%f meters)\n"
+                                  "exceeds the height of the computational domain (%f meters).",
+                                  thk_range.max, m_grid->Lz());
   }
 
   if (m_config->get_boolean("geometry.part_grid.enabled")) {
@@ -416,8 +415,6 @@ void IceModel::bootstrap_2d(const PIO &input_file) {
   }
 
   // check if Lz is valid
-  Range thk_range = m_geometry.ice_thickness.range();
-
   if (thk_range.max > m_grid->Lz()) {
     throw RuntimeError::formatted(PISM_ERROR_LOCATION, "Max. ice thickness (%3.3f m)\n"
                                   "exceeds the height of the computational domain (%3.3f m).",
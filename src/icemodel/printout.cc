@@ -68,14 +68,12 @@ unsigned int count_CFL_violations(const IceModelVec3 &u3,
         *u = u3.get_column(i, j),
         *v = v3.get_column(i, j);
 
-      // check horizontal CFL conditions at each point
+      // check horizontal CFL conditions at each point; accumulate the
+      // comparison results directly instead of branching on them (near the
+      // fast-flow margin these branches are essentially unpredictable)
       for (int k = 0; k <= ks; k++) {
-        if (fabs(u[k]) > CFL_x) {
-          CFL_violation_count += 1;
-        }
-        if (fabs(v[k]) > CFL_y) {
-          CFL_violation_count += 1;
-        }
+        CFL_violation_count += static_cast<unsigned int>(fabs(u[k]) > CFL_x);
+        CFL_violation_count += static_cast<unsigned int>(fabs(v[k]) > CFL_y);
       }
     }
   } catch (...) {
@@ -143,10 +143,9 @@ void IceModel::max_timestep(double &dt_result, unsigned int &skip_counter_result
   }
 
   // Always consider the maximum allowed time-step length.
-  if (m_config->get_double("time_stepping.maximum_time_step") > 0.0) {
-    restrictions.push_back(MaxTimestep(m_config->get_double("time_stepping.maximum_time_step",
-                                                            "seconds"),
-                                       "max"));
+  const double max_timestep = m_config->get_double("time_stepping.maximum_time_step", "seconds");
+  if (max_timestep > 0.0) {
+    restrictions.push_back(MaxTimestep(max_timestep, "max"));
   }
 
   // Never go past the end of a run.
@@ -47,6 +47,12 @@ Signal `SIGUSR2` makes PISM flush time-series, without saving model state.
  */
 int IceModel::process_signals() {
 
+  // Common case: no signal is pending and this (per time step) call is a
+  // single load and compare.
+  if (pism_signal == 0) {
+    return 0;
+  }
+
   if (pism_signal == SIGTERM) {
     m_log->message(1,
        "\ncaught signal SIGTERM:  EXITING EARLY and saving with original filename.\n");
@@ -126,12 +132,17 @@ bool check_maximum_ice_thickness(const IceModelVec2S &ice_thickness) {
 
   IceModelVec::AccessList list(ice_thickness);
 
+  const int
+    xs = grid->xs(), xm = grid->xm(),
+    ys = grid->ys(), ym = grid->ym();
+
+  // count violations branchlessly, streaming one unit-stride row at a time
   unsigned int counter = 0;
-  for (Points p(*grid); p; p.next()) {
-    const int i = p.i(), j = p.j();
+  for (int j = ys; j < ys + ym; j++) {
+    const double *H_row = ice_thickness.row(j);
 
-    if (ice_thickness(i, j) > Lz) {
-      counter += 1;
+    for (int i = xs; i < xs + xm; i++) {
+      counter += static_cast<unsigned int>(H_row[i] > Lz);
     }
   }
 
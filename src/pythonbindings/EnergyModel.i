@@ -5,6 +5,7 @@
 #include "energy/enthSystem.hh"
 using pism::MaskValue;
 #include "energy/tempSystem.hh"
+#include "energy/BedrockColumn.hh"
 %}
 
 %rename(EnergyModelInputs) pism::energy::Inputs;
@@ -18,6 +19,9 @@ using pism::MaskValue;
 %rename(get_lambda) pism::energy::tempSystemCtx::lambda;
 %include "energy/tempSystem.hh"
 
+/* wrap the bedrock column solver to make testing easier */
+%include "energy/BedrockColumn.hh"
+
 %shared_ptr(pism::energy::EnergyModel)
 %include "energy/EnergyModel.hh"
 
@@ -152,8 +152,7 @@ void SIAFD::update(const IceModelVec2V &sliding_velocity,
                       *inputs.geometry,
                       inputs.enthalpy,
                       inputs.age,
-                      m_h_x, m_h_y, m_D);
-  compute_diffusive_flux(m_h_x, m_h_y, m_D, m_diffusive_flux);
+                      m_h_x, m_h_y, m_D, m_diffusive_flux);
   profiling.end("sia.flux");
 
   if (full_update) {
@@ -507,7 +506,8 @@ void SIAFD::surface_gradient_haseloff(const Inputs &inputs,
 }
 
 
-//! \brief Compute the SIA diffusivity. If full_update, also store delta on the staggered grid.
+//! \brief Compute the SIA diffusivity and the diffusive flux. If full_update,
+//! also store delta on the staggered grid.
 /*!
  * Recall that \f$ Q = -D \nabla h \f$ is the diffusive flux in the mass-continuity equation
  *
@@ -542,10 +542,16 @@ void SIAFD::surface_gradient_haseloff(const Inputs &inputs,
  *
  * The trapezoidal rule is used to approximate the integral.
  *
+ * The diffusive flux \f$Q = -D \nabla h\f$ is filled in the same sweep: the
+ * surface gradient components are in registers anyway (they are needed for the
+ * driving stress), so computing \f$Q\f$ here avoids re-reading `h_x`, `h_y`
+ * and the just-computed diffusivity in a separate pass.
+ *
  * \param[in]  full_update the boolean flag specitying if we're doing a "full" update.
  * \param[in]  h_x x-component of the surface gradient, on the staggered grid
  * \param[in]  h_y y-component of the surface gradient, on the staggered grid
  * \param[out] result diffusivity of the SIA flow
+ * \param[out] flux diffusive flux of the SIA flow, on the staggered grid
  */
 void SIAFD::compute_diffusivity(bool full_update,
                                 const Geometry &geometry,
@@ -553,7 +559,8 @@ void SIAFD::compute_diffusivity(bool full_update,
                                 const IceModelVec3 *age,
                                 const IceModelVec2Stag &h_x,
                                 const IceModelVec2Stag &h_y,
-                                IceModelVec2Stag &result) {
+                                IceModelVec2Stag &result,
+                                IceModelVec2Stag &flux) {
   IceModelVec2S
     &thk_smooth = m_work_2d[0],
     &theta      = m_work_2d[1];
@@ -585,7 +592,7 @@ void SIAFD::compute_diffusivity(bool full_update,
 
   m_bed_smoother->smoothed_thk(h, H, mask, thk_smooth);
 
-  IceModelVec::AccessList list{&result, &theta, &thk_smooth, &h_x, &h_y, enthalpy};
+  IceModelVec::AccessList list{&result, &flux, &theta, &thk_smooth, &h_x, &h_y, enthalpy};
 
   if (use_age) {
     assert(age->stencil_width() >= 2);
@@ -634,6 +641,7 @@ void SIAFD::compute_diffusivity(bool full_update,
         // zero thickness case:
         if (thk == 0.0) {
           result(i, j, o) = 0.0;
+          flux(i, j, o)   = 0.0;
           if (full_update) {
             m_delta[o].set_column(i, j, 0.0);
           }
@@ -686,7 +694,10 @@ void SIAFD::compute_diffusivity(bool full_update,
           }
         }
 
-        const double alpha = sqrt(PetscSqr(h_x(i, j, o)) + PetscSqr(h_y(i, j, o)));
+        const double
+          slope_x = h_x(i, j, o),
+          slope_y = h_y(i, j, o),
+          alpha   = sqrt(PetscSqr(slope_x) + PetscSqr(slope_y));
         for (int k = 0; k <= ks; ++k) {
           stress[k] = alpha * pressure[k];
         }
@@ -694,9 +705,10 @@ void SIAFD::compute_diffusivity(bool full_update,
         m_flow_law->flow_n(&stress[0], &E[0], &pressure[0], &ice_grain_size[0], ks + 1,
                            &flow[0]);
 
-        const double theta_local = 0.5 * (theta(i, j) + theta(i+oi, j+oj));
+        // 2 theta, a constant factor of every delta value in this column
+        const double theta2 = theta(i, j) + theta(i+oi, j+oj);
         for (int k = 0; k <= ks; ++k) {
-          delta_ij[k] = e_factor[k] * theta_local * 2.0 * pressure[k] * flow[k];
+          delta_ij[k] = e_factor[k] * theta2 * pressure[k] * flow[k];
         }
 
         double D = 0.0;  // diffusivity for deformational SIA flow
@@ -732,6 +744,7 @@ void SIAFD::compute_diffusivity(bool full_update,
         D_max = std::max(D_max, D);
 
         result(i, j, o) = D;
+        flux(i, j, o)   = - D * ((o == 0) ? slope_x : slope_y);
 
         // if doing the full update, fill the delta column above the ice and
         // store it:
@@ -767,29 +780,6 @@ void SIAFD::compute_diffusivity(bool full_update,
   }
 }
 
-void SIAFD::compute_diffusive_flux(const IceModelVec2Stag &h_x, const IceModelVec2Stag &h_y,
-                                   const IceModelVec2Stag &diffusivity,
-                                   IceModelVec2Stag &result) {
-
-  IceModelVec::AccessList list{&diffusivity, &h_x, &h_y, &result};
-
-  for (int o = 0; o < 2; o++) {
-    ParallelSection loop(m_grid->com);
-    try {
-      for (PointsWithGhosts p(*m_grid); p; p.next()) {
-        const int i = p.i(), j = p.j();
-
-        const double slope = (o == 0) ? h_x(i, j, o) : h_y(i, j, o);
-
-        result(i, j, o) = - diffusivity(i, j, o) * slope;
-      }
-    } catch (...) {
-      loop.failed();
-    }
-    loop.check();
-  } // o-loop
-}
-
 //! \brief Compute I.
 /*!
  * This computes
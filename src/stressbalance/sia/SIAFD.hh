@@ -85,11 +85,8 @@ protected:
                                    const IceModelVec3 *age,
                                    const IceModelVec2Stag &h_x,
                                    const IceModelVec2Stag &h_y,
-                                   IceModelVec2Stag &result);
-
-  virtual void compute_diffusive_flux(const IceModelVec2Stag &h_x, const IceModelVec2Stag &h_y,
-                                      const IceModelVec2Stag &diffusivity,
-                                      IceModelVec2Stag &result);
+                                   IceModelVec2Stag &result,
+                                   IceModelVec2Stag &flux);
 
   virtual void compute_3d_horizontal_velocity(const Geometry &geometry,
                                               const IceModelVec2Stag &h_x,
@@ -17,10 +17,13 @@
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <cmath>                // floor, fabs
+
 #include "timestepping.hh"
 #include "pism/util/IceGrid.hh"
 #include "pism/util/iceModelVec.hh"
 #include "pism/util/IceModelVec2CellType.hh"
+#include "pism/util/Mask.hh"
 #include "pism/util/pism_utilities.hh"
 
 namespace pism {
@@ -56,34 +59,44 @@ CFLData max_timestep_cfl_3d(const IceModelVec2S &ice_thickness,
     one_over_dx = 1.0 / grid->dx(),
     one_over_dy = 1.0 / grid->dy();
 
-  double u_max = 0.0, v_max = 0.0, w_max = 0.0;
+  const int
+    xs = grid->xs(), xm = grid->xm(),
+    ys = grid->ys(), ym = grid->ym();
+
+  double u_max = 0.0, v_max = 0.0, w_max = 0.0, max_denom = 0.0;
   ParallelSection loop(grid->com);
   try {
-    for (Points p(*grid); p; p.next()) {
-      const int i = p.i(), j = p.j();
+    // Sweep rows in storage order: the mask and thickness are then read with
+    // unit stride, and the per-cell work reduces to the column loops.
+    for (int j = ys; j < ys + ym; j++) {
+      const double
+        *mask_row = cell_type.row(j),
+        *H_row    = ice_thickness.row(j);
 
-      if (cell_type.icy(i, j)) {
-        const int ks = grid->kBelowHeight(ice_thickness(i, j));
-        const double
-          *u = u3.get_column(i, j),
-          *v = v3.get_column(i, j),
-          *w = w3.get_column(i, j);
+      for (int i = xs; i < xs + xm; i++) {
+        const int M = static_cast<int>(floor(mask_row[i] + 0.5));
 
-        for (int k = 0; k <= ks; ++k) {
+        if (mask::icy(M)) {
+          const int ks = grid->kBelowHeight(H_row[i]);
           const double
-            u_abs = fabs(u[k]),
-            v_abs = fabs(v[k]);
-          u_max = std::max(u_max, u_abs);
-          v_max = std::max(v_max, v_abs);
-          const double denom = fabs(u_abs * one_over_dx) + fabs(v_abs * one_over_dy);
-          if (denom > 0.0) {
-            dt_max = std::min(dt_max, 1.0 / denom);
+            *u = u3.get_column(i, j),
+            *v = v3.get_column(i, j),
+            *w = w3.get_column(i, j);
+
+          // one pass over the three columns: u[k], v[k] and w[k] are all in
+          // L1 while the four reductions use them
+          for (int k = 0; k <= ks; ++k) {
+            const double
+              u_abs = fabs(u[k]),
+              v_abs = fabs(v[k]);
+            u_max = std::max(u_max, u_abs);
+            v_max = std::max(v_max, v_abs);
+            w_max = std::max(w_max, fabs(w[k]));
+            // the time step bound is 1/denom: track the maximum denominator
+            // and take a single reciprocal after the loop
+            max_denom = std::max(max_denom, u_abs * one_over_dx + v_abs * one_over_dy);
           }
         }
-
-        for (int k = 0; k <= ks; ++k) {
-          w_max = std::max(w_max, fabs(w[k]));
-        }
       }
     }
   } catch (...) {
@@ -91,12 +104,21 @@ CFLData max_timestep_cfl_3d(const IceModelVec2S &ice_thickness,
   }
   loop.check();
 
+  // one all-reduce for all four quantities: the time step bound is a max
+  // reduction, too, since dt_max = 1/max(denom)
+  double local[4] = {u_max, v_max, w_max, max_denom}, global[4];
+  GlobalMax(grid->com, local, global, 4);
+
+  if (global[3] > 0.0) {
+    dt_max = std::min(dt_max, 1.0 / global[3]);
+  }
+
   CFLData result;
 
-  result.u_max = GlobalMax(grid->com, u_max);
-  result.v_max = GlobalMax(grid->com, v_max);
-  result.w_max = GlobalMax(grid->com, w_max);
-  result.dt_max = MaxTimestep(GlobalMin(grid->com, dt_max));
+  result.u_max  = global[0];
+  result.v_max  = global[1];
+  result.w_max  = global[2];
+  result.dt_max = MaxTimestep(dt_max);
 
   return result;
 }
@@ -121,36 +143,54 @@ CFLData max_timestep_cfl_2d(const IceModelVec2S &ice_thickness,
   double dt_max = config->get_double("time_stepping.maximum_time_step", "seconds");
 
   const double
-    dx = grid->dx(),
-    dy = grid->dy();
+    one_over_dx = 1.0 / grid->dx(),
+    one_over_dy = 1.0 / grid->dy();
 
   IceModelVec::AccessList list{&velocity, &cell_type};
 
-  double u_max = 0.0, v_max = 0.0;
-  for (Points p(*grid); p; p.next()) {
-    const int i = p.i(), j = p.j();
+  const int
+    xs = grid->xs(), xm = grid->xm(),
+    ys = grid->ys(), ym = grid->ym();
 
-    if (cell_type.icy(i, j)) {
-      const double
-        u_abs = fabs(velocity(i, j).u),
-        v_abs = fabs(velocity(i, j).v);
+  double u_max = 0.0, v_max = 0.0, max_denom = 0.0;
+  // Sweep rows in storage order so that the mask and the velocity are read
+  // with unit stride, and hoist the divisions out of the loop.
+  for (int j = ys; j < ys + ym; j++) {
+    const double *mask_row = cell_type.row(j);
 
-      u_max = std::max(u_max, u_abs);
-      v_max = std::max(v_max, v_abs);
+    for (int i = xs; i < xs + xm; i++) {
+      const int M = static_cast<int>(floor(mask_row[i] + 0.5));
+
+      if (mask::icy(M)) {
+        const Vector2 &U = velocity(i, j);
+        const double
+          u_abs = fabs(U.u),
+          v_abs = fabs(U.v);
 
-      const double denom = u_abs / dx + v_abs / dy;
-      if (denom > 0.0) {
-        dt_max = std::min(dt_max, 1.0 / denom);
+        u_max = std::max(u_max, u_abs);
+        v_max = std::max(v_max, v_abs);
+
+        // as above: a single reciprocal after the loop replaces a divide per
+        // icy cell
+        max_denom = std::max(max_denom, u_abs * one_over_dx + v_abs * one_over_dy);
       }
     }
   }
 
+  // as in max_timestep_cfl_3d(): one all-reduce for all three quantities
+  double local[3] = {u_max, v_max, max_denom}, global[3];
+  GlobalMax(grid->com, local, global, 3);
+
+  if (global[2] > 0.0) {
+    dt_max = std::min(dt_max, 1.0 / global[2]);
+  }
+
   CFLData result;
 
-  result.u_max = GlobalMax(grid->com, u_max);
-  result.v_max = GlobalMax(grid->com, v_max);
-  result.w_max = 0.0;
-  result.dt_max = MaxTimestep(GlobalMin(grid->com, dt_max));
+  result.u_max  = global[0];
+  result.v_max  = global[1];
+  result.w_max  = 0.0;
+  result.dt_max = MaxTimestep(dt_max);
 
   return result;
 }
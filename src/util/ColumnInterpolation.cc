@@ -19,6 +19,7 @@
 
 #include "ColumnInterpolation.hh"
 
+#include <algorithm>            // std::max
 #include <cmath>
 
 namespace pism {
@@ -139,6 +140,22 @@ void ColumnInterpolation::fine_to_coarse(const double *input, double *result) co
   result[N - 1] = input[m_fine2coarse[N - 1]];
 }
 
+//! Like fine_to_coarse(), but clamping results from below as they are
+//! written, so the caller does not need a separate pass over the column.
+void ColumnInterpolation::fine_to_coarse_clamped(const double *input, double min_value,
+                                                 double *result) const {
+  const unsigned int N = Mz_coarse();
+
+  for (unsigned int k = 0; k < N - 1; ++k) {
+    const int m = m_fine2coarse[k];
+
+    const double increment = (m_z_coarse[k] - m_z_fine[m]) / (m_z_fine[m + 1] - m_z_fine[m]);
+    result[k] = std::max(input[m] + increment * (input[m + 1] - input[m]), min_value);
+  }
+
+  result[N - 1] = std::max(input[m_fine2coarse[N - 1]], min_value);
+}
+
 unsigned int ColumnInterpolation::Mz_coarse() const {
   return m_z_coarse.size();
 }
@@ -31,6 +31,7 @@ public:
 
   void coarse_to_fine(const double *input, unsigned int ks, double *result) const;
   void fine_to_coarse(const double *input, double *result) const;
+  void fine_to_coarse_clamped(const double *input, double min_value, double *result) const;
 
   // These two methods allocate fresh storage for the output.
   std::vector<double> coarse_to_fine(const std::vector<double> &input, unsigned int ks) const;
@@ -286,6 +286,12 @@ void columnSystemCtx::fine_to_coarse(const std::vector<double> &fine, int i, int
   m_interp->fine_to_coarse(&fine[0], array);
 }
 
+void columnSystemCtx::fine_to_coarse_clamped(const std::vector<double> &fine, int i, int j,
+                                             IceModelVec3& coarse, double min_value) const {
+  double *array = coarse.get_column(i, j);
+  m_interp->fine_to_coarse_clamped(&fine[0], min_value, array);
+}
+
 void columnSystemCtx::coarse_to_fine(const IceModelVec3 &coarse, int i, int j,
                                      double* fine) const {
   const double *array = coarse.get_column(i, j);
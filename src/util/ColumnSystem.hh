@@ -153,6 +153,8 @@ public:
   const std::vector<double>& z() const;
   void fine_to_coarse(const std::vector<double> &fine, int i, int j,
                       IceModelVec3& coarse) const;
+  void fine_to_coarse_clamped(const std::vector<double> &fine, int i, int j,
+                              IceModelVec3& coarse, double min_value) const;
 protected:
   TridiagonalSystem *m_solver;
 
@@ -168,6 +168,7 @@ TSDiagnostic::TSDiagnostic(IceGrid::ConstPtr g, const std::string &name)
   m_start        = 0;
 
   m_buffer_size = (size_t)m_config->get_double("output.timeseries.buffer_size");
+  m_ts.reserve(m_buffer_size);
 
   m_ts.variable().set_string("ancillary_variables", name + "_aux");
 
@@ -284,6 +285,13 @@ void TSRateDiagnostic::evaluate(double t0, double t1, double change) {
 
 void TSDiagnostic::update(double t0, double t1) {
   this->update_impl(t0, t1);
+
+  // Once the buffer fills up, write the accumulated records as one slab: a
+  // flush() writes each variable using a single NetCDF call, amortizing the
+  // file open and define-mode overhead over buffer_size records.
+  if (m_ts.times().size() >= m_buffer_size and not m_output_filename.empty()) {
+    flush();
+  }
 }
 
 void TSSnapshotDiagnostic::update_impl(double t0, double t1) {
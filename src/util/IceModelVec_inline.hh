@@ -53,6 +53,20 @@ inline const double& IceModelVec2S::operator()(int i, int j) const {
   return static_cast<double**>(m_array)[j][i];
 }
 
+inline double* IceModelVec2S::row(int j) {
+#if (PISM_DEBUG==1)
+  check_array_indices(m_grid->xs(), j, 0);
+#endif
+  return static_cast<double**>(m_array)[j];
+}
+
+inline const double* IceModelVec2S::row(int j) const {
+#if (PISM_DEBUG==1)
+  check_array_indices(m_grid->xs(), j, 0);
+#endif
+  return static_cast<double**>(m_array)[j];
+}
+
 inline StarStencil<double> IceModelVec2S::star(int i, int j) const {
   const IceModelVec2S &self = *this;
 
@@ -28,8 +28,53 @@ void GeometryCalculator::compute(const IceModelVec2S& sea_level,
                                  const IceModelVec2S& thickness,
                                  IceModelVec2Int& out_mask,
                                  IceModelVec2S& out_surface) const {
-  compute_mask(sea_level, bed, thickness, out_mask);
-  compute_surface(sea_level, bed, thickness, out_surface);
+  const unsigned int
+    mask_stencil    = out_mask.stencil_width(),
+    surface_stencil = out_surface.stencil_width();
+
+  // In the common case the two outputs have the same stencil width and we can
+  // classify and compute the surface elevation in one pass over the inputs,
+  // instead of re-reading sea level, bed, and thickness a second time.
+  if (mask_stencil == surface_stencil) {
+    IceModelVec::AccessList list{&sea_level, &bed, &thickness, &out_mask, &out_surface};
+
+    const IceGrid &grid = *bed.grid();
+
+    assert(sea_level.stencil_width() >= mask_stencil);
+    assert(bed.stencil_width()       >= mask_stencil);
+    assert(thickness.stencil_width() >= mask_stencil);
+
+    const int
+      stencil = static_cast<int>(mask_stencil),
+      i_first = grid.xs() - stencil,
+      i_last  = grid.xs() + grid.xm() + stencil - 1,
+      j_first = grid.ys() - stencil,
+      j_last  = grid.ys() + grid.ym() + stencil - 1;
+
+    // Hoist row pointers out of the inner loop so that the compiler sees flat
+    // unit-stride arrays.
+    for (int j = j_first; j <= j_last; ++j) {
+      const double
+        *sl_row  = sea_level.row(j),
+        *bed_row = bed.row(j),
+        *H_row   = thickness.row(j);
+      double
+        *mask_row    = out_mask.row(j),
+        *surface_row = out_surface.row(j);
+
+      for (int i = i_first; i <= i_last; ++i) {
+        int M = 0;
+        double h = 0.0;
+        this->compute(sl_row[i], bed_row[i], H_row[i], &M, &h);
+
+        mask_row[i]    = M;
+        surface_row[i] = h;
+      }
+    }
+  } else {
+    compute_mask(sea_level, bed, thickness, out_mask);
+    compute_surface(sea_level, bed, thickness, out_surface);
+  }
 }
 
 void GeometryCalculator::compute_mask(const IceModelVec2S &sea_level,
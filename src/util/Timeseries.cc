@@ -53,6 +53,7 @@ void Timeseries::private_constructor(MPI_Comm c, const std::string &dimension_na
   m_dimension.set_string("bounds", dimension_name + "_bounds");
 
   m_use_bounds = true;
+  m_last_index = 0;
 }
 
 //! Ensure that time bounds have the same units as the dimension.
@@ -179,11 +180,19 @@ void Timeseries::write(const PIO &nc) const {
   }
 }
 
+//! Pre-allocate storage for `length` records to avoid re-allocations in append().
+void Timeseries::reserve(size_t length) {
+  m_time.reserve(length);
+  m_values.reserve(length);
+  m_time_bounds.reserve(2 * length);
+}
+
 //! Clear storage.
 void Timeseries::reset() {
   m_time.clear();
   m_values.clear();
   m_time_bounds.clear();
+  m_last_index = 0;
 }
 
 /** Scale all values stored in this instance by `scaling_factor`.
@@ -209,14 +218,26 @@ double Timeseries::operator()(double t) const {
 
   // piecewise-constant case:
   if (m_use_bounds) {
-    auto j = lower_bound(m_time_bounds.begin(), m_time_bounds.end(), t); // binary search
-
-    if (j == m_time_bounds.end()) {
-      return m_values.back(); // out of range (on the right)
+    int i = 0;
+
+    // Queries are usually monotone in time, so check whether the interval
+    // found by the previous call still brackets t before doing a binary
+    // search.
+    const size_t k = m_last_index;
+    if (k > 0 and k < m_time_bounds.size() and
+        m_time_bounds[k - 1] < t and t <= m_time_bounds[k]) {
+      i = (int)k;
+    } else {
+      auto j = lower_bound(m_time_bounds.begin(), m_time_bounds.end(), t); // binary search
+
+      if (j == m_time_bounds.end()) {
+        return m_values.back(); // out of range (on the right)
+      }
+
+      i = (int)(j - m_time_bounds.begin());
+      m_last_index = i;
     }
 
-    int i = (int)(j - m_time_bounds.begin());
-
     if (i == 0) {
       return m_values[0];         // out of range (on the left)
     }
@@ -231,15 +252,24 @@ double Timeseries::operator()(double t) const {
   }
 
   // piecewise-linear case:
-  auto end = m_time.end();
+  int i = 0;
 
-  auto j = lower_bound(m_time.begin(), end, t); // binary search
+  // re-use the interval found by the previous call, if possible (see above)
+  const size_t k = m_last_index;
+  if (k > 0 and k < m_time.size() and m_time[k - 1] < t and t <= m_time[k]) {
+    i = (int)k;
+  } else {
+    auto end = m_time.end();
 
-  if (j == end) {
-    return m_values.back(); // out of range (on the right)
-  }
+    auto j = lower_bound(m_time.begin(), end, t); // binary search
 
-  int i = (int)(j - m_time.begin());
+    if (j == end) {
+      return m_values.back(); // out of range (on the right)
+    }
+
+    i = (int)(j - m_time.begin());
+    m_last_index = i;
+  }
 
   if (i == 0) {
     return m_values[0];   // out of range (on the left)
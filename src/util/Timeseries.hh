@@ -19,7 +19,6 @@
 #ifndef __Timeseries_hh
 #define __Timeseries_hh
 
-#include <deque>
 #include <mpi.h>
 
 #include "VariableMetadata.hh"
@@ -84,6 +83,8 @@ public:
   double average(double t, double dt, unsigned int N) const;
   void append(double value, double a, double b);
 
+  void reserve(size_t length);
+
   void reset();
 
   TimeseriesMetadata& variable();
@@ -118,6 +119,10 @@ private:
   std::vector<double> m_values;
   std::vector<double> m_time_bounds;
 
+  //! index of the interval found by the last operator() call; used as a hint
+  //! to avoid binary searches for (typical) monotone-in-time queries
+  mutable size_t m_last_index;
+
   void set_bounds_units();
   void private_constructor(MPI_Comm com, const std::string &dimension_name);
   void report_range(const Logger &log);
@@ -17,6 +17,7 @@
 // Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include <cassert>
+#include <limits>
 
 #include "pism_utilities.hh"
 #include "iceModelVec.hh"
@@ -141,27 +142,42 @@ void IceModelVec::set_time_independent(bool flag) {
 
 //! Result: min <- min(v[j]), max <- max(v[j]).
 /*!
-PETSc manual correctly says "VecMin and VecMax are collective on Vec" but
-GlobalMax,GlobalMin \e are needed, when m_has_ghosts==true, to get correct
-values because Vecs created with DACreateLocalVector() are of type
-VECSEQ and not VECMPI.  See src/trypetsc/localVecMax.c.
+Scans the local part of the Vec once and combines the two extrema in a single
+reduction (using max(-x) = -min(x)) instead of calling VecMin() and VecMax(),
+which cost one MPI_Allreduce() each on global Vecs and produce local values
+only on ghosted Vecs, because Vecs created with DACreateLocalVector() are of
+type VECSEQ and not VECMPI.  See src/trypetsc/localVecMax.c.
  */
 Range IceModelVec::range() const {
-  Range result;
   PetscErrorCode ierr;
   assert(m_v != NULL);
 
-  ierr = VecMin(m_v, NULL, &result.min);
-  PISM_CHK(ierr, "VecMin");
+  PetscInt size = 0;
+  ierr = VecGetLocalSize(m_v, &size);
+  PISM_CHK(ierr, "VecGetLocalSize");
 
-  ierr = VecMax(m_v, NULL, &result.max);
-  PISM_CHK(ierr, "VecMax");
+  const double *array = NULL;
+  ierr = VecGetArrayRead(m_v, &array);
+  PISM_CHK(ierr, "VecGetArrayRead");
 
-  if (m_has_ghosts) {
-    // needs a reduce operation; use GlobalMin and GlobalMax;
-    result.min = GlobalMin(m_grid->com, result.min);
-    result.max = GlobalMax(m_grid->com, result.max);
+  double
+    min_local = std::numeric_limits<double>::max(),
+    max_local = -std::numeric_limits<double>::max();
+
+  for (PetscInt k = 0; k < size; ++k) {
+    min_local = std::min(min_local, array[k]);
+    max_local = std::max(max_local, array[k]);
   }
+
+  ierr = VecRestoreArrayRead(m_v, &array);
+  PISM_CHK(ierr, "VecRestoreArrayRead");
+
+  double local[2] = {-min_local, max_local}, global[2];
+  GlobalMax(m_grid->com, local, global, 2);
+
+  Range result;
+  result.min = -global[0];
+  result.max = global[1];
   return result;
 }
 
@@ -440,11 +456,20 @@ void IceModelVec::regrid_impl(const PIO &file, RegriddingFlag flag,
     petsc::TemporaryGlobalVec tmp(m_da);
     petsc::VecArray tmp_array(tmp);
 
-    io::regrid_spatial_variable(metadata(0), *m_grid, file, flag,
-                                m_report_range, allow_extrapolation,
-                                default_value, m_interpolation_type, tmp_array.get());
+    bool found = io::regrid_spatial_variable(metadata(0), *m_grid, file, flag,
+                                             m_report_range, allow_extrapolation,
+                                             default_value, m_interpolation_type,
+                                             tmp_array.get());
 
-    global_to_local(m_da, tmp, m_v);
+    if (found) {
+      global_to_local(m_da, tmp, m_v);
+    } else {
+      // The variable was not found and every value (ghosts included) is
+      // default_value, so we can skip the scatter and set the local Vec
+      // directly.
+      PetscErrorCode ierr = VecSet(m_v, default_value);
+      PISM_CHK(ierr, "VecSet");
+    }
   } else {
     petsc::VecArray v_array(m_v);
     io::regrid_spatial_variable(metadata(0), *m_grid,  file, flag,
@@ -768,7 +793,9 @@ std::vector<double> IceModelVec::norm_all(int n) const {
 
   if (m_has_ghosts) {
     // needs a reduce operation; use GlobalMax() if NORM_INFINITY,
-    // otherwise GlobalSum; carefully in NORM_2 case
+    // otherwise GlobalSum; carefully in NORM_2 case. All m_dof components
+    // are combined in one reduction to avoid issuing m_dof collectives.
+    std::vector<double> local(result);
     switch (type) {
     case NORM_1_AND_2: {
       throw RuntimeError::formatted(PISM_ERROR_LOCATION, "IceModelVec::norm_all(...): NORM_1_AND_2"
@@ -777,22 +804,22 @@ std::vector<double> IceModelVec::norm_all(int n) const {
 
     }
     case NORM_1: {
-      for (unsigned int k = 0; k < m_dof; ++k) {
-        result[k] = GlobalSum(m_grid->com, result[k]);
-      }
+      GlobalSum(m_grid->com, &local[0], &result[0], m_dof);
       return result;
     }
     case NORM_2: {
+      // undo sqrt in VecNorm before sum; sum up; take sqrt
       for (unsigned int k = 0; k < m_dof; ++k) {
-        // undo sqrt in VecNorm before sum; sum up; take sqrt
-        result[k] = sqrt(GlobalSum(m_grid->com, result[k]*result[k]));
+        local[k] = local[k] * local[k];
+      }
+      GlobalSum(m_grid->com, &local[0], &result[0], m_dof);
+      for (unsigned int k = 0; k < m_dof; ++k) {
+        result[k] = sqrt(result[k]);
       }
       return result;
     }
     case NORM_INFINITY: {
-      for (unsigned int k = 0; k < m_dof; ++k) {
-        result[k] = GlobalMax(m_grid->com, result[k]);
-      }
+      GlobalMax(m_grid->com, &local[0], &result[0], m_dof);
       return result;
     }
     default: {
@@ -464,6 +464,17 @@ public:
   inline double& operator() (int i, int j);
   inline const double& operator()(int i, int j) const;
   inline StarStencil<double> star(int i, int j) const;
+
+  //! Direct access to the row `j` of the internal double array; the result is
+  //! indexed using *global* indices `i`, just like operator().
+  /*!
+    Values in a row are contiguous in memory, so hot per-cell kernels can use
+    row pointers to avoid re-computing the `[j][i]` indexing for every access.
+    Only valid between begin_access() and end_access() calls (or while an
+    AccessList referencing this vector is alive).
+  */
+  inline double* row(int j);
+  inline const double* row(int j) const;
 };
 
 
@@ -103,14 +103,24 @@ void IceModelVec2S::set_to_magnitude(const IceModelVec2S &v_x,
                                      const IceModelVec2S &v_y) {
   IceModelVec::AccessList list{this, &v_x, &v_y};
 
-  for (Points p(*m_grid); p; p.next()) {
-    const int i = p.i(), j = p.j();
-
-    (*this)(i,j) = sqrt(PetscSqr(v_x(i,j)) + PetscSqr(v_y(i,j)));
+  const int
+    xs = m_grid->xs(), xm = m_grid->xm(),
+    ys = m_grid->ys(), ym = m_grid->ym();
+
+  // Sweep unit-stride rows so the compiler can vectorize the square root.
+  for (int j = ys; j < ys + ym; j++) {
+    const double
+      *x_row = v_x.row(j),
+      *y_row = v_y.row(j);
+    double *result_row = this->row(j);
+
+    for (int i = xs; i < xs + xm; i++) {
+      result_row[i] = sqrt(PetscSqr(x_row[i]) + PetscSqr(y_row[i]));
+    }
   }
 
   inc_state_counter();          // mark as modified
-  
+
 }
 
 void IceModelVec2S::set_to_magnitude(const IceModelVec2V &input) {
@@ -176,12 +176,46 @@ double IceModelVec3D::getValZ(int i, int j, double z) const {
   return valm + incr * (arr[j][i][mcurr+1] - valm);
 }
 
+//! Finds the index `kb` of the level just below `z` and the weight `lambda` of
+//! the level `kt` above it.
+/*!
+ * The getHorSlice() methods interpolate a whole plane at one fixed `z`, so the
+ * bracketing levels and the weight are the same for every column: compute them
+ * once here instead of searching the level array per grid point. For `z` at or
+ * above the top level `kt == kb` and `lambda == 0.0`, so the formula
+ * `column[kb] + lambda * (column[kt] - column[kb])` never reads past the end
+ * of a column and reproduces getValZ() exactly.
+ */
+static void bracket_level(const std::vector<double> &zlevels,
+                          gsl_interp_accel *accel, double z,
+                          unsigned int &kb, unsigned int &kt, double &lambda) {
+  const unsigned int nlevels = zlevels.size();
+
+  kb     = 0;
+  lambda = 0.0;
+
+  if (z >= zlevels.back()) {
+    kb = nlevels - 1;
+  } else if (z > zlevels.front()) {
+    kb     = gsl_interp_accel_find(accel, &zlevels[0], nlevels, z);
+    lambda = (z - zlevels[kb]) / (zlevels[kb + 1] - zlevels[kb]);
+  }
+
+  kt = kb + 1 < nlevels ? kb + 1 : kb;
+}
+
 //! Copies a horizontal slice at level z of an IceModelVec3 into a Vec gslice.
 /*!
  * FIXME: this method is misnamed: the slice is horizontal in the PISM
  * coordinate system, not in reality.
  */
 void  IceModelVec3::getHorSlice(Vec &gslice, double z) const {
+#if (PISM_DEBUG==1)
+  if (not isLegalLevel(z)) {
+    throw RuntimeError::formatted(PISM_ERROR_LOCATION, "IceModelVec3 getHorSlice(): level %f is not legal; name = %s",
+                                  z, m_name.c_str());
+  }
+#endif
 
   petsc::DM::Ptr da2 = m_grid->get_dm(1, m_grid->ctx()->config()->get_double("grid.max_stencil_width"));
 
@@ -189,11 +223,16 @@ void  IceModelVec3::getHorSlice(Vec &gslice, double z) const {
   petsc::DMDAVecArray slice(da2, gslice);
   double **slice_val = (double**)slice.get();
 
+  unsigned int kb = 0, kt = 0;
+  double lambda = 0.0;
+  bracket_level(m_zlevels, m_bsearch_accel, z, kb, kt, lambda);
+
   ParallelSection loop(m_grid->com);
   try {
     for (Points p(*m_grid); p; p.next()) {
       const int i = p.i(), j = p.j();
-      slice_val[j][i] = getValZ(i,j,z);
+      const double *column = get_column(i, j);
+      slice_val[j][i] = column[kb] + lambda * (column[kt] - column[kb]);
     }
   } catch (...) {
     loop.failed();
@@ -207,13 +246,25 @@ void  IceModelVec3::getHorSlice(Vec &gslice, double z) const {
  * coordinate system, not in reality.
  */
 void  IceModelVec3::getHorSlice(IceModelVec2S &gslice, double z) const {
+#if (PISM_DEBUG==1)
+  if (not isLegalLevel(z)) {
+    throw RuntimeError::formatted(PISM_ERROR_LOCATION, "IceModelVec3 getHorSlice(): level %f is not legal; name = %s",
+                                  z, m_name.c_str());
+  }
+#endif
+
   IceModelVec::AccessList list{this, &gslice};
 
+  unsigned int kb = 0, kt = 0;
+  double lambda = 0.0;
+  bracket_level(m_zlevels, m_bsearch_accel, z, kb, kt, lambda);
+
   ParallelSection loop(m_grid->com);
   try {
     for (Points p(*m_grid); p; p.next()) {
       const int i = p.i(), j = p.j();
-      gslice(i, j) = getValZ(i, j, z);
+      const double *column = get_column(i, j);
+      gslice(i, j) = column[kb] + lambda * (column[kt] - column[kb]);
     }
   } catch (...) {
     loop.failed();
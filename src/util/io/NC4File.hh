@@ -33,6 +33,11 @@ public:
 protected:
   // implementations:
   // open/create/close
+
+  //! Raise NetCDF's default per-variable chunk cache before opening or
+  //! creating a file. Called by derived classes' open_impl()/create_impl().
+  static void set_chunk_cache();
+
   virtual int close_impl();
 
   // redef/enddef
@@ -39,6 +39,8 @@ int NC4_Serial::integer_open_mode(IO_Mode input) const {
 int NC4_Serial::open_impl(const std::string &fname, IO_Mode mode) {
   int stat;
 
+  set_chunk_cache();
+
   int nc_mode = integer_open_mode(mode);
   stat = nc_open(fname.c_str(), nc_mode, &m_file_id);
 
@@ -48,6 +50,8 @@ int NC4_Serial::open_impl(const std::string &fname, IO_Mode mode) {
 int NC4_Serial::create_impl(const std::string &fname) {
   int stat;
 
+  set_chunk_cache();
+
   stat = nc_create(fname.c_str(), NC_NETCDF4, &m_file_id);
 
   return stat;
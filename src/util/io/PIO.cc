@@ -508,29 +508,46 @@ void PIO::def_dim(const std::string &name, size_t length) const {
   }
 }
 
+//! Compute chunking dimensions for a spatial (2D or 3D) variable.
+/*!
+  Use one record (one 2D or 3D spatial slab) per chunk: PISM reads and writes
+  whole records, so this turns each record access into a single contiguous
+  chunk access instead of scattering it over many small chunks chosen by the
+  NetCDF-4 default heuristic. Has no effect with NetCDF-3 backends (see
+  NCFile::def_var_chunking_impl()).
+*/
+static vector<size_t> chunk_dimensions(const vector<size_t> &dim_lengths) {
+  vector<size_t> result = dim_lengths;
+
+  // record (time) dimension, if any: one record per chunk
+  if (result.size() > 2) {
+    result[0] = 1;
+  }
+
+  // chunk lengths have to be positive (the time dimension may be empty)
+  for (unsigned int k = 0; k < result.size(); ++k) {
+    result[k] = result[k] > 0 ? result[k] : 1;
+  }
+
+  return result;
+}
+
 //! \brief Define a variable.
 void PIO::def_var(const string &name, IO_Type nctype, const vector<string> &dims) const {
   try {
     m_impl->nc->def_var(name, nctype, dims);
 
-    // FIXME: I need to write and tune chunk_dimensions that would be called below before we use
-    // this.
-    //
-    /*
-    // if it's not a spatial variable, we're done
-    if (dims.size() < 2) {
-      return;
-    }
-
-    std::vector<size_t> dim_lengths;
-    for (unsigned int k = 0; k < dims.size(); ++k) {
-      dim_lengths.push_back(this->inq_dimlen(dims[k]));
-    }
+    // set chunking parameters for spatial variables
+    if (dims.size() >= 2) {
+      vector<size_t> dim_lengths;
+      for (unsigned int k = 0; k < dims.size(); ++k) {
+        dim_lengths.push_back(this->inq_dimlen(dims[k]));
+      }
 
-    std::vector<size_t> chunk_dims = chunk_dimensions(nctype, dim_lengths);
+      vector<size_t> chunk_dims = chunk_dimensions(dim_lengths);
 
-    m_impl->nc->def_var_chunking(name, chunk_dims);
-    */
+      m_impl->nc->def_var_chunking(name, chunk_dims);
+    }
 
   } catch (RuntimeError &e) {
     e.add_context("defining variable '%s' in '%s'", name.c_str(), inq_filename().c_str());
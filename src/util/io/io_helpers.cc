@@ -781,8 +781,11 @@ void write_spatial_variable(const SpatialVariableMetadata &var,
   - sets `v` to `default_value` if `flag` is `OPTIONAL` and the
     variable was not found in the input file
   - uses the last record in the file
+
+  Returns true if the variable was found in the input file and false if it was
+  not and `default_value` was used instead.
  */
-void regrid_spatial_variable(SpatialVariableMetadata &var,
+bool regrid_spatial_variable(SpatialVariableMetadata &var,
                              const IceGrid& grid, const PIO &nc,
                              RegriddingFlag flag, bool report_range,
                              bool allow_extrapolation,
@@ -793,9 +796,9 @@ void regrid_spatial_variable(SpatialVariableMetadata &var,
                                           var.get_string("standard_name"),
                                           var.unit_system());
 
-  regrid_spatial_variable(var, grid, nc, t_length - 1, flag,
-                          report_range, allow_extrapolation,
-                          default_value, interpolation_type, output);
+  return regrid_spatial_variable(var, grid, nc, t_length - 1, flag,
+                                 report_range, allow_extrapolation,
+                                 default_value, interpolation_type, output);
 }
 
 static void compute_range(MPI_Comm com, double *data, size_t data_size, double *min, double *max) {
@@ -892,7 +895,7 @@ static void check_grid_overlap(const grid_info &input, const IceGrid &internal,
   }
 }
 
-void regrid_spatial_variable(SpatialVariableMetadata &variable,
+bool regrid_spatial_variable(SpatialVariableMetadata &variable,
                              const IceGrid& grid, const PIO &file,
                              unsigned int t_start, RegriddingFlag flag,
                              bool report_range,
@@ -998,6 +1001,8 @@ void regrid_spatial_variable(SpatialVariableMetadata &variable,
       output[k] = default_value;
     }
   } // end of if (exists)
+
+  return exists;
 }
 
 
@@ -42,7 +42,7 @@ class Config;
 
 namespace io {
 
-void regrid_spatial_variable(SpatialVariableMetadata &var,
+bool regrid_spatial_variable(SpatialVariableMetadata &var,
                              const IceGrid& grid, const PIO &nc,
                              RegriddingFlag flag, bool do_report_range,
                              bool allow_extrapolation,
@@ -50,7 +50,7 @@ void regrid_spatial_variable(SpatialVariableMetadata &var,
                              InterpolationType type,
                              double *output);
 
-void regrid_spatial_variable(SpatialVariableMetadata &var,
+bool regrid_spatial_variable(SpatialVariableMetadata &var,
                              const IceGrid& grid, const PIO &nc,
                              unsigned int t_start,
                              RegriddingFlag flag, bool do_report_range,
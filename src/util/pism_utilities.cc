@@ -283,23 +283,31 @@ std::string timestamp(MPI_Comm com) {
 
 //! Creates a string with the user name, hostname and the time-stamp (for history strings).
 std::string username_prefix(MPI_Comm com) {
-  PetscErrorCode ierr;
+  // The user and host names are invariants of the process; look them up once
+  // and re-use the result (the history is stamped at every save event).
+  static std::string user_at_host;
+
+  if (user_at_host.empty()) {
+    PetscErrorCode ierr;
+
+    char username[50];
+    ierr = PetscGetUserName(username, sizeof(username));
+    PISM_CHK(ierr, "PetscGetUserName");
+    if (ierr != 0) {
+      username[0] = '\0';
+    }
+    char hostname[100];
+    ierr = PetscGetHostName(hostname, sizeof(hostname));
+    PISM_CHK(ierr, "PetscGetHostName");
+    if (ierr != 0) {
+      hostname[0] = '\0';
+    }
 
-  char username[50];
-  ierr = PetscGetUserName(username, sizeof(username));
-  PISM_CHK(ierr, "PetscGetUserName");
-  if (ierr != 0) {
-    username[0] = '\0';
-  }
-  char hostname[100];
-  ierr = PetscGetHostName(hostname, sizeof(hostname));
-  PISM_CHK(ierr, "PetscGetHostName");
-  if (ierr != 0) {
-    hostname[0] = '\0';
+    user_at_host = std::string(username) + "@" + hostname;
   }
 
   std::ostringstream message;
-  message << username << "@" << hostname << " " << timestamp(com) << ": ";
+  message << user_at_host << " " << timestamp(com) << ": ";
 
   std::string result = message.str();
   unsigned int length = result.size();
@@ -314,23 +322,29 @@ std::string username_prefix(MPI_Comm com) {
 //! \brief Uses argc and argv to create the string with current PISM
 //! command-line arguments.
 std::string args_string() {
-  int argc;
-  char **argv;
-  PetscErrorCode ierr = PetscGetArgs(&argc, &argv);
-  PISM_CHK(ierr, "PetscGetArgs");
-
-  std::string cmdstr, argument;
-  for (int j = 0; j < argc; j++) {
-    argument = argv[j];
-
-    // enclose arguments containing spaces with double quotes:
-    if (argument.find(" ") != std::string::npos) {
-      argument = "\"" + argument + "\"";
+  // The command line does not change after PetscInitialize(): join it once
+  // and re-use the result for every history stamp.
+  static std::string cmdstr;
+
+  if (cmdstr.empty()) {
+    int argc;
+    char **argv;
+    PetscErrorCode ierr = PetscGetArgs(&argc, &argv);
+    PISM_CHK(ierr, "PetscGetArgs");
+
+    std::string argument;
+    for (int j = 0; j < argc; j++) {
+      argument = argv[j];
+
+      // enclose arguments containing spaces with double quotes:
+      if (argument.find(" ") != std::string::npos) {
+        argument = "\"" + argument + "\"";
+      }
+
+      cmdstr += std::string(" ") + argument;
     }
-
-    cmdstr += std::string(" ") + argument;
+    cmdstr += "\n";
   }
-  cmdstr += "\n";
 
   return cmdstr;
 }
@@ -948,3 +948,56 @@ def vertical_extrapolation_during_regridding_test():
     # clean up
     import os
     os.remove("test.nc")
+
+
+def bedrock_column_test():
+    """Compare the cached-factorization bedrock column solver to a direct
+    solution of the same tridiagonal system, including the smallest supported
+    column (M == 2), where the first row is also the next-to-last one."""
+    ctx = PISM.Context()
+    config = ctx.config
+
+    k = config.get_double("energy.bedrock_thermal_conductivity")
+    rho = config.get_double("energy.bedrock_thermal_density")
+    c = config.get_double("energy.bedrock_thermal_specific_heat_capacity")
+    D = k / (rho * c)
+
+    dz = 100.0
+    dt = PISM.util.convert(100.0, "years", "seconds")
+
+    Q_bottom = 0.042
+    T_top = 260.0
+
+    def direct_solve(T_old, M):
+        "Assemble and solve the bedrock column system directly."
+        R = D * dt / (dz * dz)
+        G = -Q_bottom / k
+
+        A = np.zeros((M, M))
+        b = np.zeros(M)
+
+        # Neumann condition at the bottom
+        A[0, 0] = 1.0 + 2.0 * R
+        A[0, 1] = -2.0 * R
+        b[0] = T_old[0] - 2.0 * G * dz * R
+
+        for j in range(1, M - 1):
+            A[j, j - 1] = -R
+            A[j, j] = 1.0 + 2.0 * R
+            A[j, j + 1] = -R
+            b[j] = T_old[j]
+
+        # Dirichlet condition at the top
+        A[M - 1, M - 1] = 1.0
+        b[M - 1] = T_top
+
+        return np.linalg.solve(A, b)
+
+    for M in [2, 3, 21]:
+        column = PISM.BedrockColumn("btu", config, dz, M)
+
+        T_old = np.linspace(270.0, T_top, M)
+
+        T_new = np.array(column.solve(dt, Q_bottom, T_top, T_old))
+
+        np.testing.assert_almost_equal(T_new, direct_solve(T_old, M))